@@ -13,4 +13,5 @@ target_compile_options(${PROJECT_NAME} PRIVATE -Wall)
 # Link libraries
 target_link_libraries(${PROJECT_NAME}
     m
+    pthread
 )
@@ -55,9 +55,106 @@
 #define DJ_GRAPH_GRAPH_MAX_PATH_LENGHT (100)
 
 /**
- * @brief Maximum number of paths generated
+ * @brief Maximum number of search states of a solve
+ * @note Once the list is full, the dominance ignores the bins (see DJ_SOLVER_HEADING_BINS) : the solve keeps fewer
+ *       states and still ends, but its path can be slower
  */
-#define DJ_GRAPH_GRAPH_MAX_PATHS (DJ_GRAPH_GRAPH_MAX_NODES)
+#define DJ_GRAPH_GRAPH_MAX_PATHS (2 * DJ_GRAPH_GRAPH_MAX_NODES)
+
+/**
+ * @brief Number of arrival heading bins of the search states
+ * @note A state is dropped if another one with the same end point, heading bin and speed bin is as fast if the robot
+ *       stops at the end point and as fast if it goes on, whatever the remaining distance. The pre-rotation of the next
+ *       segment depends on the exact heading and the next segments on the exact speed, so a dropped state can still
+ *       lead to a faster path : more bins keep more states and give faster paths, at the cost of the memory of the
+ *       search (see DJ_GRAPH_GRAPH_MAX_PATHS).
+ */
+#define DJ_SOLVER_HEADING_BINS (8)
+
+/**
+ * @brief Number of arrival speed bins of the search states
+ * @see DJ_SOLVER_HEADING_BINS
+ */
+#define DJ_SOLVER_SPEED_BINS (4)
+
+/**
+ * @brief Width of the arrival speed bins of the search states (mm/s)
+ * @note The last bin contains all the speeds above
+ */
+#define DJ_SOLVER_SPEED_BIN_WIDTH (250)
+
+/**
+ * @brief Maximum number of targets of a single search (see dj_genarate_paths_to_targets)
+ */
+#define DJ_SOLVER_MAX_TARGETS (8)
+
+/**
+ * @brief Initial weight of the heuristic of the anytime solve (see dj_genarate_path_with_budget)
+ * @note The first search is greedy to find a path quickly, the next ones lower the weight to improve it
+ *       until the weight reaches 1 (optimal search) or the budget is spent
+ */
+#define DJ_SOLVER_ANYTIME_INITIAL_WEIGHT (3.0f)
+
+/**
+ * @brief Decrease of the weight of the heuristic between two searches of the anytime solve
+ * @see DJ_SOLVER_ANYTIME_INITIAL_WEIGHT
+ */
+#define DJ_SOLVER_ANYTIME_WEIGHT_STEP (1.0f)
+
+/**
+ * @brief Default tolerance of the A* solver : the duration of the path is at most (1 + epsilon) times the duration of
+ *        the fastest one
+ * @note The heuristic is weighted by (1 + epsilon), so fewer states are explored. 0 for the fastest path.
+ *       It can be changed for each query (see dj_planner_config_t).
+ */
+#define DJ_SOLVER_ASTAR_EPSILON (0.0f)
+
+/**
+ * @brief Maximum share of the length of an alternative path along the segments of a faster one
+ *        (see dj_genarate_alternative_paths)
+ */
+#define DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP (0.5f)
+
+/**
+ * @brief Maximum ratio between the duration of an alternative path and the duration of the fastest one
+ * @see DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP
+ */
+#define DJ_SOLVER_ALTERNATIVE_MAX_STRETCH (1.5f)
+
+/**
+ * DJ_PREBUILT_TABLE_MODE
+ * @brief Precomputation of the shortest paths between all the prebuilt nodes (see dj_genarate_static_path)
+ * @note The table is computed when the prebuilt graph is built or updated
+ *
+ * DJ_PREBUILT_TABLE_MODE_NONE
+ * @brief No table, the static paths are searched as the other paths
+ *
+ * DJ_PREBUILT_TABLE_MODE_FULL
+ * @brief Distances on 32 bits and next hops on 16 bits, for up to DJ_GRAPH_GRAPH_MAX_NODES prebuilt nodes
+ *
+ * DJ_PREBUILT_TABLE_MODE_COMPACT
+ * @brief Distances on 16 bits and next hops on 8 bits, for up to DJ_PREBUILT_TABLE_COMPACT_MAX_NODES
+ *        prebuilt nodes (sized for the STM32F4)
+ */
+#define DJ_PREBUILT_TABLE_MODE_NONE 0
+#define DJ_PREBUILT_TABLE_MODE_FULL 1
+#define DJ_PREBUILT_TABLE_MODE_COMPACT 2
+#if defined(__linux__) || defined(_WIN32)
+#define DJ_PREBUILT_TABLE_MODE DJ_PREBUILT_TABLE_MODE_FULL
+#else
+#define DJ_PREBUILT_TABLE_MODE DJ_PREBUILT_TABLE_MODE_COMPACT
+#endif
+#if (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_COMPACT)
+#define DJ_PREBUILT_TABLE_COMPACT_MAX_NODES (64)
+#endif
+
+/**
+ * @brief Number of landmarks of the prebuilt graph (0 to disable them)
+ * @note The length of the shortest path from each landmark to each prebuilt node is kept
+ *       (4 * DJ_PREBUILT_NB_LANDMARKS * DJ_GRAPH_GRAPH_MAX_NODES bytes). The triangle inequality gives a lower bound
+ *       of the distance between two nodes which takes the obstacles into account (see dj_solver_heuristic_landmarks).
+ */
+#define DJ_PREBUILT_NB_LANDMARKS (4)
 
 /**
  * @brief DJ enable/disable logs of dj
@@ -70,9 +167,102 @@
  * @brief Enable / disable the optimization of the rebuild
  * @note The optimization consists in not adding the nodes of dynamic obstacles.
  *      The consequence is that the robot will go along the static obstacles only.
+ * @note Default value, it can be changed for each query (see dj_planner_config_t)
  */
 #define DJ_ENABLE_REBUILD_OPTIMIZATION 1
 
+/**
+ * @brief Enable or disable the SIMD kernels (SSE2 / AVX2 on x86, NEON on ARM)
+ * @note Targets without SIMD (like the STM32F4) always use the scalar fallback
+ * @see dj_quartic.c
+ */
+#define DJ_ENABLE_SIMD 1
+
+/**
+ * DJ_DYNAMIC_OBSTACLE_MODE
+ * @brief How the dynamic obstacles are taken into account when the graph is rebuilt
+ *
+ * DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS
+ * @brief The dynamic obstacles are converted into static polygons in space time from each viewer,
+ *        the links crossing these polygons are disabled
+ *
+ * DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS
+ * @brief The links leaving the viewer are validated directly in space time:
+ *        the robot profile along the link is compared to the trajectory of each dynamic obstacle
+ *        and the link is disabled if they meet during the traversal
+ *
+ * DJ_CONTINUOUS_VALIDATION_STEP_MS
+ * @brief Time step used to sample the traversal of a link in continuous mode
+ */
+#define DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS 0
+#define DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS 1
+#define DJ_DYNAMIC_OBSTACLE_MODE DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS
+#define DJ_CONTINUOUS_VALIDATION_STEP_MS 20 // ms
+
+/**
+ * @brief Enable or disable the broad phase of the dynamic obstacles computation
+ * @details Before solving the position of a dynamic obstacle in space time, a conservative bound
+ *          of the area swept by the obstacle during its lifetime is compared to the area the robot can reach
+ *          during the same horizon. If they don't overlap, the obstacle is skipped.
+ * @see dj_obstacle_dynamic_may_be_reached
+ */
+#define DJ_ENABLE_DYNAMIC_OBSTACLE_BROAD_PHASE 1
+
+/**
+ * DJ_ENABLE_PLANNER_SERVICE
+ * @brief Enable or disable the service which plans the path to the current target in the background
+ *        (see dj_planner_service.h). It uses its own planner (see dj_planner_t).
+ *
+ * DJ_ENABLE_PLANNER_SERVICE_THREAD
+ * @brief Plan in a thread (pthread), otherwise the paths are planned by slices from the main loop
+ *        (see dj_planner_service_process). It can be set by the build to test the slices on Linux
+ *        (see linux_slices_preset).
+ *
+ * DJ_PLANNER_SERVICE_PERIOD_US
+ * @brief Period of the planning of the path to the current target (us)
+ */
+#if defined(__linux__) || defined(_WIN32)
+#define DJ_ENABLE_PLANNER_SERVICE 1
+#else
+#define DJ_ENABLE_PLANNER_SERVICE 0
+#endif
+#if DJ_ENABLE_PLANNER_SERVICE
+#ifndef DJ_ENABLE_PLANNER_SERVICE_THREAD
+#if defined(__linux__)
+#define DJ_ENABLE_PLANNER_SERVICE_THREAD 1
+#else
+#define DJ_ENABLE_PLANNER_SERVICE_THREAD 0
+#endif
+#endif
+#define DJ_PLANNER_SERVICE_PERIOD_US 50000
+#endif
+
+/**
+ * DJ_ENABLE_PLAN_CACHE
+ * @brief Enable or disable the precomputation of the paths to the probable next targets during the idle time
+ *        (see dj_plan_cache.h). It uses its own planner (see dj_planner_t).
+ *
+ * DJ_PLAN_CACHE_MAX_TARGETS
+ * @brief Maximum number of probable next targets
+ *
+ * DJ_PLAN_CACHE_MAX_START_DISTANCE
+ * @brief Maximum distance between the position of the robot and the start of a precomputed path to use it (mm)
+ *
+ * DJ_PLAN_CACHE_MAX_START_SPEED_DIFFERENCE
+ * @brief Maximum difference between the speed of the robot and the start speed of a precomputed path to use it (mm/s)
+ *
+ * DJ_PLAN_CACHE_MAX_AGE_MS
+ * @brief Maximum age of a precomputed path to use it (ms, time of the robot), the dynamic obstacles move even if they
+ *        aren't refreshed
+ */
+#define DJ_ENABLE_PLAN_CACHE DJ_ENABLE_PLANNER_SERVICE
+#if DJ_ENABLE_PLAN_CACHE
+#define DJ_PLAN_CACHE_MAX_TARGETS 4
+#define DJ_PLAN_CACHE_MAX_START_DISTANCE 10          // mm
+#define DJ_PLAN_CACHE_MAX_START_SPEED_DIFFERENCE 20 // mm/s
+#define DJ_PLAN_CACHE_MAX_AGE_MS 1000               // ms
+#endif
+
 /**
  * ENABLE_RECALCULATION
  * @brief Enable or disable the recalculation of the path during the displacement
@@ -121,6 +311,27 @@
  */
 #define DJ_OBSTACLE_MANAGER_MAX_IMPORTED_OBSTACLES 5
 
+/**
+ * DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+ * @brief Enable or disable the pool of dynamic obstacles allocated at runtime (see dj_dynamic_obstacle_pool.h)
+ * @note Disabled by default on the microcontrollers: each obstacle manager reserves about 22 kB for a full pool
+ *
+ * DJ_DYNAMIC_OBSTACLE_POOL_SIZE
+ * @brief Maximum number of dynamic obstacles which are allocated at runtime in the dynamic obstacle pool
+ * @note Each obstacle of the pool also reserves a place for each of its solutions in the obstacle manager
+ *       (DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS)
+ */
+#if defined(__linux__) || defined(_WIN32)
+#define DJ_ENABLE_DYNAMIC_OBSTACLE_POOL 1
+#else
+#define DJ_ENABLE_DYNAMIC_OBSTACLE_POOL 0
+#endif
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+#define DJ_DYNAMIC_OBSTACLE_POOL_SIZE 16
+#else
+#define DJ_DYNAMIC_OBSTACLE_POOL_SIZE 0
+#endif
+
 /**
  * @brief Number max of points of a polygon
  */
@@ -10,6 +10,7 @@
 /* ******************************************************* Includes ****************************************************** */
 
 #include "dj_dependencies.h"
+#include "api/time/time.h"
 #include "pos_simulator/pos_simulator.h"
 
 /* **************************************************** Private macros *************************************************** */
@@ -32,9 +33,8 @@ void dj_dep_get_robot_position(GEOMETRY_point_t *robot_position)
 
 void dj_dep_get_robot_speed(GEOMETRY_vector_t *robot_speed)
 {
-    // Fictive values
-    robot_speed->x = 0;
-    robot_speed->y = 0;
+    // Get the speed from the simulator
+    *robot_speed = pos_simulator_get_speed();
 }
 
 void dj_dep_get_robot_acceleration(GEOMETRY_vector_t *robot_acceleration)
@@ -46,8 +46,13 @@ void dj_dep_get_robot_acceleration(GEOMETRY_vector_t *robot_acceleration)
 
 void dj_dep_get_time(time32_t *time)
 {
-    // Fictive value
-    *time = 0;
+    // Get the time from the simulator
+    *time = pos_simulator_get_time();
+}
+
+void dj_dep_get_time_us(uint32_t *time)
+{
+    *time = (uint32_t)time_us();
 }
 
 /* ***************************************** Public callback functions definitions *************************************** */
@@ -66,6 +66,13 @@ void dj_dep_get_robot_acceleration(GEOMETRY_vector_t *robot_acceleration);
  */
 void dj_dep_get_time(time32_t *time);
 
+/**
+ * @brief Get a monotonic time in microseconds (used to bound the solving duration)
+ * @note The value can wrap around, only the differences between two values are used
+ * @param time The time in microseconds
+ */
+void dj_dep_get_time_us(uint32_t *time);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -58,4 +58,11 @@ void dj_graph_node_enable(dj_graph_node_t *node, bool enable)
     node->m_enabled = enable;
 }
 
+uint32_t dj_graph_node_get_bucket(const GEOMETRY_point_t *pos, uint32_t nb_buckets)
+{
+    dj_control_non_null(pos, 0);
+    uint32_t hash = ((uint32_t)(uint16_t)pos->x * 73856093u) ^ ((uint32_t)(uint16_t)pos->y * 19349663u);
+    return hash % nb_buckets;
+}
+
 /* ******************************************* Public callback functions declarations ************************************ */
@@ -70,6 +70,15 @@ bool dj_graph_node_compare(dj_graph_node_t *node1, dj_graph_node_t *node2);
  */
 void dj_graph_node_enable(dj_graph_node_t *node, bool enable);
 
+/**
+ * @brief Function to get the bucket of a position in a hash map of nodes
+ *
+ * @param pos Location of the node
+ * @param nb_buckets Number of buckets of the hash map
+ * @return uint32_t Index of the bucket
+ */
+uint32_t dj_graph_node_get_bucket(const GEOMETRY_point_t *pos, uint32_t nb_buckets);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -22,10 +22,10 @@
 
 /* ********************************************* Private functions declarations ****************************************** */
 
-static time32_t dj_graph_segment_get_duration(GEOMETRY_segment_t *segment,
-                                              int16_t initial_speed,
-                                              bool immobile_at_last_point);
-static time32_t dj_graph_rotation_get_duration(int16_t angle_diff);
+static void dj_graph_path_move_along_segment(dj_viewer_status_t *status,
+                                             time32_t *duration,
+                                             GEOMETRY_point_t *final_point,
+                                             GEOMETRY_point_t *next_point);
 
 /* ************************************************** Private variables ************************************************** */
 
@@ -34,20 +34,79 @@ static time32_t dj_graph_rotation_get_duration(int16_t angle_diff);
 MAGIC_ARRAY_SRC(point_list, GEOMETRY_point_t)
 
 /**
- * @brief Calculate the duration of a segment
+ * @brief Function to move the viewer along a segment of a path
  *
- * @param segment Segment to calculate the duration
- * @param accel Acceleration of the viewer
- * @param initial_speed Initial speed of the viewer
- * @param immobile_at_last_point True if the viewer is immobile at the last point
- *
- * @return time32_t Duration of the segment
- *
- * @warning The initial speed must be coherent with the angle betwin the segment and the viewer speed
+ * @param [in,out] status Status of the viewer at the start of the segment, updated to the end of the segment
+ * @param [in,out] duration Duration of the path, increased by the duration of the segment (and of its pre rotation)
+ * @param [in] final_point End of the segment
+ * @param [in] next_point Next point of the path (NULL if the segment is the last one)
  */
-static time32_t dj_graph_segment_get_duration(GEOMETRY_segment_t *segment,
-                                              int16_t initial_speed,
-                                              bool immobile_at_last_point)
+static void dj_graph_path_move_along_segment(dj_viewer_status_t *status,
+                                             time32_t *duration,
+                                             GEOMETRY_point_t *final_point,
+                                             GEOMETRY_point_t *next_point)
+{
+    // The viewer must be immobile at the end of the last segment
+    bool immobile_at_last_point = true;
+    int16_t angle_link = 0;
+    GEOMETRY_point_t *initial_point = &status->m_position;
+
+    if (next_point != NULL)
+    {
+        // Check if a pre rotation is needed after the current segment
+        int16_t next_angle_link;
+        int16_t angle_diff;
+
+        angle_link = GEOMETRY_viewing_angle(initial_point->x, initial_point->y, final_point->x, final_point->y);
+        next_angle_link = GEOMETRY_viewing_angle(final_point->x, final_point->y, next_point->x, next_point->y);
+        angle_diff = GEOMETRY_modulo_angle(next_angle_link - angle_link);
+
+        immobile_at_last_point = is_pre_rotation_needed(angle_diff);
+        if (immobile_at_last_point)
+        {
+            // A pre rotation is needed so the robot must be immobile at the last point
+            // Calculate the duration of the rotation of the viewer at the end of the segment
+            *duration += dj_graph_rotation_get_duration(angle_diff);
+        }
+    }
+
+    int32_t initial_speed = sqrt(status->m_speed.x * status->m_speed.x + status->m_speed.y * status->m_speed.y);
+
+    // Calculate the segment
+    GEOMETRY_segment_t current_segment = {*initial_point, *final_point};
+
+    // Calculate the duration of the segment
+    time32_t current_duration = dj_graph_segment_get_duration(&current_segment, initial_speed, immobile_at_last_point);
+    *duration += current_duration;
+
+    // Update the status
+    status->m_position = *final_point;
+    status->m_time += current_duration;
+    /*
+        Calculate the new speed
+        With a constant acceleration (a) and a initial speed (v)
+        v = a * t
+        but t is in ms, so :
+        v = a * t / 1000
+        but speed is a vector, so :
+        vx = a * t / 1000 * cos(angle)
+        vy = a * t / 1000 * sin(angle)
+    */
+    if (immobile_at_last_point)
+    {
+        status->m_speed = (GEOMETRY_vector_t){0, 0};
+    }
+    else
+    {
+        status->m_speed
+            = (GEOMETRY_vector_t){status->m_speed.x + PROP_LINEAR_ACCELERATION * current_duration * cosf(angle_link) / 1000,
+                                  status->m_speed.y + PROP_LINEAR_ACCELERATION * current_duration * sinf(angle_link) / 1000};
+    }
+}
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+time32_t dj_graph_segment_get_duration(GEOMETRY_segment_t *segment, int16_t initial_speed, bool immobile_at_last_point)
 {
     dj_control_non_null(segment, 0);
     /*
@@ -122,13 +181,7 @@ static time32_t dj_graph_segment_get_duration(GEOMETRY_segment_t *segment,
     return duration;
 }
 
-/**
- * @brief Function to calculate the time of a pure rotation
- *
- * @param angle_diff Angle difference between the viewer and the target
- * @return time32_t Duration of the rotation
- */
-static time32_t dj_graph_rotation_get_duration(int16_t angle_diff)
+time32_t dj_graph_rotation_get_duration(int16_t angle_diff)
 {
     /*
         Calculate the duration of a pure rotation
@@ -155,8 +208,6 @@ static time32_t dj_graph_rotation_get_duration(int16_t angle_diff)
     return duration;
 }
 
-/* *********************************************** Public functions declarations ***************************************** */
-
 void dj_graph_path_init(dj_graph_path_t *path, dj_viewer_status_t *init_status)
 {
     dj_control_non_null(path, );
@@ -176,8 +227,15 @@ int32_t dj_graph_path_add_point(dj_graph_path_t *path, GEOMETRY_point_t *point)
 {
     dj_control_non_null(path, -1);
     dj_control_non_null(point, -1);
-    point_list_add(&path->m_points, point);
-    path->must_be_recomputed = true;
+    if (point_list_add(&path->m_points, point) == NULL)
+    {
+        return -1;
+    }
+    if (!path->must_be_recomputed)
+    {
+        // The evaluation is up to date, only the end of the path has to be evaluated
+        dj_graph_path_evaluation_extend(&path->m_evaluation, &path->m_evaluation, point);
+    }
     return point_list_size(&path->m_points) - 1;
 }
 
@@ -216,101 +274,22 @@ time32_t dj_graph_path_get_duration(dj_graph_path_t *path)
     dj_control_non_null(path, 0);
     if (!path->must_be_recomputed)
     {
-        return path->m_duration;
+        return path->m_evaluation.m_duration;
     }
     dj_mark_start_time(DJ_MARK_PATH_DURATION);
-    // Check if there is enough points to calculate the duration
-    // Only one point : the duration is 0
-    if (point_list_size(&path->m_points) < 2)
-    {
-        path->m_duration = 0;
-        path->m_end_status = path->m_init_status;
-        path->must_be_recomputed = false;
-        return 0;
-    }
-    time32_t duration = 0;
-    dj_viewer_status_t status = path->m_init_status;
-    for (uint32_t i = 1; i < point_list_size(&path->m_points) - 1; i++)
+    // Evaluate the path point by point from its initial status
+    dj_graph_path_evaluation_init(&path->m_evaluation, &path->m_init_status);
+    for (uint32_t i = 1; i < point_list_size(&path->m_points); i++)
     {
-        bool immobile_at_last_point = false;
-        GEOMETRY_point_t *initial_point = &status.m_position;
-        GEOMETRY_point_t *final_point = point_list_get(&path->m_points, i);
-        dj_control_non_null(final_point, 0);
-        GEOMETRY_point_t *next_point = point_list_get(&path->m_points, i + 1);
-        dj_control_non_null(next_point, 0);
-        // Check if a pre rotation is needed after the current segment
-        int16_t angle_link;
-        int16_t next_angle_link;
-        int16_t angle_diff;
-
-        angle_link = GEOMETRY_viewing_angle(initial_point->x, initial_point->y, final_point->x, final_point->y);
-        next_angle_link = GEOMETRY_viewing_angle(final_point->x, final_point->y, next_point->x, next_point->y);
-        angle_diff = GEOMETRY_modulo_angle(next_angle_link - angle_link);
-
-        int32_t initial_speed = sqrt(status.m_speed.x * status.m_speed.x + status.m_speed.y * status.m_speed.y);
-
-        // Check if a pre rotation is needed after the current segment
-        if (is_pre_rotation_needed(angle_diff))
-        {
-            // A pre rotation is needed so the robot must be immobile at the last point
-            immobile_at_last_point = true;
-            // Calculate the duration of the rotation of the viewer at the end of the segment
-            duration += dj_graph_rotation_get_duration(angle_diff);
-        }
-
-        // Calculate the segment
-        GEOMETRY_segment_t current_segment = {*initial_point, *final_point};
-
-        // Calculate the duration of the segment
-        time32_t current_duration = dj_graph_segment_get_duration(&current_segment, initial_speed, immobile_at_last_point);
-        duration += current_duration;
-
-        // Update the status
-        status.m_position = *final_point;
-        status.m_time += current_duration;
-        /*
-            Calculate the new speed
-            With a constant acceleration (a) and a initial speed (v)
-            v = a * t
-            but t is in ms, so :
-            v = a * t / 1000
-            but speed is a vector, so :
-            vx = a * t / 1000 * cos(angle)
-            vy = a * t / 1000 * sin(angle)
-        */
-        if (immobile_at_last_point)
-        {
-            status.m_speed = (GEOMETRY_vector_t){0, 0};
-        }
-        else
-        {
-            status.m_speed = (GEOMETRY_vector_t){
-                status.m_speed.x + PROP_LINEAR_ACCELERATION * current_duration * cosf(angle_link) / 1000,
-                status.m_speed.y + PROP_LINEAR_ACCELERATION * current_duration * sinf(angle_link) / 1000};
-        }
+        GEOMETRY_point_t *point = point_list_get(&path->m_points, i);
+        dj_control_non_null(point, 0);
+        dj_graph_path_evaluation_extend(&path->m_evaluation, &path->m_evaluation, point);
     }
-    // Calculate the last segment
-    GEOMETRY_point_t *initial_point = &status.m_position;
-    GEOMETRY_point_t *final_point = point_list_get(&path->m_points, point_list_size(&path->m_points) - 1);
-    dj_control_non_null(final_point, 0);
-    GEOMETRY_segment_t current_segment = {*initial_point, *final_point};
-    int32_t initial_speed = sqrt(status.m_speed.x * status.m_speed.x + status.m_speed.y * status.m_speed.y);
-    time32_t current_duration = dj_graph_segment_get_duration(&current_segment, initial_speed, true);
-    duration += current_duration;
-    // Update the status
-    status.m_position = *final_point;
-    status.m_time += current_duration;
-    // Update the speed
-    status.m_speed = (GEOMETRY_vector_t){0, 0};
-
-    // Update path parameters
-    path->m_duration = duration;
-    path->m_end_status = status;
     path->must_be_recomputed = false;
 
     dj_mark_end_time(DJ_MARK_PATH_DURATION);
 
-    return duration;
+    return path->m_evaluation.m_duration;
 }
 
 void dj_graph_path_set_as_finished(dj_graph_path_t *path, bool is_finished)
@@ -332,10 +311,7 @@ void dj_graph_path_copy(dj_graph_path_t *dest, dj_graph_path_t *src)
     // Initialize the destination path
     dj_graph_path_init(dest, &src->m_init_status);
     // Copy all parameters
-    dest->m_duration = src->m_duration;
     dest->is_finished = src->is_finished;
-    dest->must_be_recomputed = src->must_be_recomputed;
-    dest->m_end_status = src->m_end_status;
     dest->m_init_status = src->m_init_status;
     // Make a copy of all points in the linked list
     // (The first point is already added in the init function)
@@ -345,6 +321,8 @@ void dj_graph_path_copy(dj_graph_path_t *dest, dj_graph_path_t *src)
         dj_control_non_null(point, );
         dj_graph_path_add_point(dest, point);
     }
+    dest->must_be_recomputed = src->must_be_recomputed;
+    dest->m_evaluation = src->m_evaluation;
 }
 
 void dj_graph_path_get_end(dj_graph_path_t *path, GEOMETRY_point_t *end)
@@ -363,7 +341,7 @@ void dj_graph_path_get_end_status(dj_graph_path_t *path, dj_viewer_status_t *end
     {
         dj_graph_path_get_duration(path);
     }
-    *end_status = path->m_end_status;
+    *end_status = path->m_evaluation.m_end_status;
 }
 
 bool dj_graph_path_is_in_path(dj_graph_path_t *path, GEOMETRY_point_t *point)
@@ -382,4 +360,42 @@ bool dj_graph_path_is_in_path(dj_graph_path_t *path, GEOMETRY_point_t *point)
     return false;
 }
 
+void dj_graph_path_evaluation_init(dj_graph_path_evaluation_t *evaluation, dj_viewer_status_t *init_status)
+{
+    dj_control_non_null(evaluation, );
+    dj_control_non_null(init_status, );
+    // Only one point : the duration is 0
+    evaluation->m_last_segment_status = *init_status;
+    evaluation->m_last_segment_duration = 0;
+    evaluation->m_end_status = *init_status;
+    evaluation->m_duration = 0;
+    evaluation->m_has_segment = false;
+}
+
+void dj_graph_path_evaluation_extend(dj_graph_path_evaluation_t *evaluation,
+                                     const dj_graph_path_evaluation_t *parent,
+                                     GEOMETRY_point_t *point)
+{
+    dj_control_non_null(evaluation, );
+    dj_control_non_null(parent, );
+    dj_control_non_null(point, );
+
+    dj_viewer_status_t status = parent->m_last_segment_status;
+    time32_t duration = parent->m_last_segment_duration;
+    if (parent->m_has_segment)
+    {
+        // The last segment of the parent isn't the last one anymore, its end depends on the new point
+        GEOMETRY_point_t last_point = parent->m_end_status.m_position;
+        dj_graph_path_move_along_segment(&status, &duration, &last_point, point);
+    }
+    evaluation->m_last_segment_status = status;
+    evaluation->m_last_segment_duration = duration;
+
+    // Calculate the last segment
+    dj_graph_path_move_along_segment(&status, &duration, point, NULL);
+    evaluation->m_end_status = status;
+    evaluation->m_duration = duration;
+    evaluation->m_has_segment = true;
+}
+
 /* ******************************************* Public callback functions declarations ************************************ */
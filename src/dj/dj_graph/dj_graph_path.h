@@ -19,9 +19,44 @@
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Maximum number of points in a path (including the initial point)
+ */
+#define DJ_GRAPH_PATH_MAX_POINTS (20)
+
 /* ************************************************** Public types definition ******************************************** */
 
-MAGIC_ARRAY_TYPEDEF(point_list, GEOMETRY_point_t, 20);
+MAGIC_ARRAY_TYPEDEF(point_list, GEOMETRY_point_t, DJ_GRAPH_PATH_MAX_POINTS);
+
+/**
+ * @brief Evaluation of the duration of a path
+ * @note The last segment of a path always ends immobile, but it may not once a point is added after it
+ *       (it depends on the pre rotation needed at its end). The status at the start of the last segment is
+ *       kept so that the path can be extended by re-evaluating only its last segment.
+ */
+typedef struct
+{
+    /**
+     * @brief Status of the viewer at the start of the last segment
+     */
+    dj_viewer_status_t m_last_segment_status;
+    /**
+     * @brief Duration of the path until the start of the last segment
+     */
+    time32_t m_last_segment_duration;
+    /**
+     * @brief Status at the end of the path
+     */
+    dj_viewer_status_t m_end_status;
+    /**
+     * @brief Duration of the path
+     */
+    time32_t m_duration;
+    /**
+     * @brief Flag to know if the path has at least one segment
+     */
+    bool m_has_segment;
+} dj_graph_path_evaluation_t;
 
 /**
  * @brief Path object
@@ -38,15 +73,11 @@ typedef struct
      */
     dj_viewer_status_t m_init_status;
     /**
-     * @brief Duration of the path
-     * @warning This value is not always up to date, please use dj_graph_path_get_duration to get the duration
-     */
-    time32_t m_duration;
-    /**
-     * @brief Status at the end of the path
-     * @warning This value is not always up to date, please use dj_graph_path_get_end_status to get the status
+     * @brief Evaluation of the duration and the end status of the path
+     * @warning This value is not always up to date, please use dj_graph_path_get_duration and
+     *          dj_graph_path_get_end_status to get the duration and the status
      */
-    dj_viewer_status_t m_end_status;
+    dj_graph_path_evaluation_t m_evaluation;
     /**
      * @brief Flag to know if the duration and the end status must be recomputed
      */
@@ -175,6 +206,48 @@ void dj_graph_path_get_end_status(dj_graph_path_t *path, dj_viewer_status_t *end
  */
 bool dj_graph_path_is_in_path(dj_graph_path_t *path, GEOMETRY_point_t *point);
 
+/**
+ * @brief Calculate the duration of a segment
+ *
+ * @param segment Segment to calculate the duration
+ * @param initial_speed Initial speed of the viewer
+ * @param immobile_at_last_point True if the viewer is immobile at the last point
+ *
+ * @return time32_t Duration of the segment
+ *
+ * @warning The initial speed must be coherent with the angle betwin the segment and the viewer speed
+ */
+time32_t dj_graph_segment_get_duration(GEOMETRY_segment_t *segment, int16_t initial_speed, bool immobile_at_last_point);
+
+/**
+ * @brief Function to calculate the time of a pure rotation
+ *
+ * @param angle_diff Angle difference between the viewer and the target
+ * @return time32_t Duration of the rotation
+ */
+time32_t dj_graph_rotation_get_duration(int16_t angle_diff);
+
+/**
+ * @brief Initialize the evaluation of a path which only contains its initial point
+ *
+ * @param [out] evaluation Evaluation to initialize
+ * @param [in] init_status Initial status of the path
+ */
+void dj_graph_path_evaluation_init(dj_graph_path_evaluation_t *evaluation, dj_viewer_status_t *init_status);
+
+/**
+ * @brief Evaluate a path extended by a point from the evaluation of the path without it
+ * @note Only the last segment of the parent path and the new segment are evaluated,
+ *       the result is identical to the evaluation of the whole path
+ *
+ * @param [out] evaluation Evaluation of the extended path (can be the parent evaluation)
+ * @param [in] parent Evaluation of the path to extend
+ * @param [in] point Point added at the end of the path
+ */
+void dj_graph_path_evaluation_extend(dj_graph_path_evaluation_t *evaluation,
+                                     const dj_graph_path_evaluation_t *parent,
+                                     GEOMETRY_point_t *point);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -154,6 +154,18 @@ void dj_graph_builder_init(dj_graph_builder_t *builder)
 
     // Initialize the obstacle manager
     dj_obstacle_manager_init(&builder->m_obstacle_manager);
+
+    builder->m_enable_rebuild_optimization = DJ_ENABLE_REBUILD_OPTIMIZATION;
+    builder->m_prebuilt_version = 0;
+    builder->m_nb_prebuilt_nodes = 0;
+    builder->m_nb_prebuilt_links = 0;
+    builder->m_links_saved = false;
+    builder->m_nb_blocked_links = 0;
+
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+    // Initialize the list of the links disabled in space time
+    blocked_links_list_init(&builder->m_blocked_links);
+#endif
 }
 
 void dj_graph_builder_deinit(dj_graph_builder_t *builder)
@@ -583,14 +595,14 @@ dj_graph_node_t *dj_graph_builder_add_node_with_verif(dj_graph_builder_t *builde
     return dj_graph_graph_add_node(&builder->m_graph, node, type);
 }
 
-void dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
-                                          dj_obstacle_static_t *obstacle,
-                                          dj_viewer_status_t *viewer_status,
-                                          bool is_prebuilt,
-                                          bool add_obstacle_as_node)
+uint32_t dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
+                                              dj_obstacle_static_t *obstacle,
+                                              dj_viewer_status_t *viewer_status,
+                                              bool is_prebuilt,
+                                              bool add_obstacle_as_node)
 {
-    dj_control_non_null(builder, );
-    dj_control_non_null(obstacle, );
+    dj_control_non_null(builder, 0);
+    dj_control_non_null(obstacle, 0);
 
     dj_debug_printf("Rebuild graph with an new obstacle\n");
 
@@ -601,18 +613,19 @@ void dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
     dj_polygon_to_geometry_polygon(&obstacle->m_shape, &geometry_polygon);
 
     // Get all the links
+    uint32_t nb_disabled_links = 0;
     uint32_t nb_links = dj_graph_graph_get_num_links(&builder->m_graph);
     for (uint32_t link_index = 0; link_index < nb_links; link_index++)
     {
         // Get the link
         dj_graph_link_t *link = dj_graph_graph_get_link(&builder->m_graph, link_index);
-        dj_control_non_null(link, );
+        dj_control_non_null(link, 0);
 
         // Get the nodes of the link
         dj_graph_node_t *node1 = dj_graph_link_get_node1(link);
         dj_graph_node_t *node2 = dj_graph_link_get_node2(link);
-        dj_control_non_null(node1, );
-        dj_control_non_null(node2, );
+        dj_control_non_null(node1, 0);
+        dj_control_non_null(node2, 0);
 
         // Check if one of the nodes is strictly on the obstacle or if the link intersects with the obstacle
         const GEOMETRY_point_t out_point = (GEOMETRY_point_t){-10000, -10000};
@@ -624,6 +637,10 @@ void dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
                                                             (GEOMETRY_segment_t){node1->m_pos, node2->m_pos}))
         {
             // Disable the link
+            if (link->m_enabled)
+            {
+                nb_disabled_links++;
+            }
             link->m_enabled = false;
         }
     }
@@ -666,6 +683,8 @@ void dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
 #endif
     // Print the markers
     dj_print_all_durations();
+
+    return nb_disabled_links;
 }
 
 void dj_graph_builder_build_without_obstacle(dj_graph_builder_t *builder,
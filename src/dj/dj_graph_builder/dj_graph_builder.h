@@ -20,16 +20,69 @@
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Size of the enabled flags of the links saved after the first rebuild (one bit per link)
+ */
+#define DJ_GRAPH_BUILDER_SAVED_LINKS_SIZE ((DJ_GRAPH_GRAPH_MAX_NODES * DJ_GRAPH_GRAPH_AVERAGE_LINKS / 2 + 7) / 8)
+
 /* ************************************************** Public types definition ******************************************** */
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+/**
+ * @brief List of the links disabled in space time from the last viewer
+ * @note A link leaving the viewer goes to another node, so there is at most one link per node
+ */
+MAGIC_ARRAY_TYPEDEF(blocked_links_list, dj_graph_link_t *, DJ_GRAPH_GRAPH_MAX_NODES);
+#endif
+
 typedef struct
 {
     dj_graph_graph_t m_graph;
     dj_obstacle_manager_t m_obstacle_manager;
+    /**
+     * @brief Enable the optimization of the rebuild (DJ_ENABLE_REBUILD_OPTIMIZATION by default)
+     */
+    bool m_enable_rebuild_optimization;
+    /**
+     * @brief Version of the prebuilt graph copied in the graph (0 if none), the copy is kept while the version is the
+     *        same (see dj_graph_builder_first_rebuild)
+     */
+    uint32_t m_prebuilt_version;
+    /**
+     * @brief Number of nodes of the copy of the prebuilt graph
+     */
+    uint32_t m_nb_prebuilt_nodes;
+    /**
+     * @brief Number of links of the copy of the prebuilt graph
+     */
+    uint32_t m_nb_prebuilt_links;
+    /**
+     * @brief Enabled flags of the links of the first rebuild, one bit per link
+     * @see dj_graph_builder_restore_first_rebuild
+     */
+    uint8_t m_saved_links[DJ_GRAPH_BUILDER_SAVED_LINKS_SIZE];
+    /**
+     * @brief True if the enabled flags of the links of the first rebuild are saved
+     */
+    bool m_links_saved;
+    /**
+     * @brief Number of links disabled by the dynamic obstacles since the first rebuild
+     */
+    uint32_t m_nb_blocked_links;
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+    /**
+     * @brief Links disabled in space time from the last viewer (they are enabled again at the next rebuild)
+     */
+    blocked_links_list_t m_blocked_links;
+#endif
 } dj_graph_builder_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+MAGIC_ARRAY_HEADER(blocked_links_list, dj_graph_link_t *);
+#endif
+
 /**
  * @brief Function to initialize the graph builder
  *
@@ -104,12 +157,13 @@ dj_graph_node_t *dj_graph_builder_add_node_with_verif(dj_graph_builder_t *builde
  * @param viewer_status The viewer status to build the graph
  * @param is_prebuilt If the nodes and links to add are prebuilt
  * @param add_obstacle_as_node If true, the obstacle will be added as a node in the graph
+ * @return uint32_t Number of links disabled by the obstacle (the links already disabled aren't counted)
  */
-void dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
-                                          dj_obstacle_static_t *obstacle,
-                                          dj_viewer_status_t *viewer_status,
-                                          bool is_prebuilt,
-                                          bool add_obstacle_as_node);
+uint32_t dj_graph_builder_build_with_obstacle(dj_graph_builder_t *builder,
+                                              dj_obstacle_static_t *obstacle,
+                                              dj_viewer_status_t *viewer_status,
+                                              bool is_prebuilt,
+                                              bool add_obstacle_as_node);
 
 /**
  * @brief Rebuild the graph ingoring an obstacle
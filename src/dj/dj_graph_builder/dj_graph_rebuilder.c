@@ -19,6 +19,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 /* **************************************************** Private macros *************************************************** */
 
@@ -27,10 +28,16 @@
 /* ********************************************* Private functions declarations ****************************************** */
 
 static void copy_prebuilt_graph(dj_graph_builder_t *builder, dj_graph_graph_t *prebuilt_graph);
+static void restore_prebuilt_graph(dj_graph_builder_t *builder, dj_graph_graph_t *prebuilt_graph);
 static void enable_all_links_and_nodes(dj_graph_builder_t *builder);
+static void save_first_rebuild_links(dj_graph_builder_t *builder);
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
 static void disable_links_on_solution(dj_graph_builder_t *builder,
                                       static_obstacles_list_t *obstacles,
                                       dj_viewer_status_t *viewer_status);
+#elif (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+static void disable_links_in_space_time(dj_graph_builder_t *builder, dj_viewer_status_t *viewer_status);
+#endif
 static void add_viewer_as_node(dj_graph_builder_t *builder,
                                dj_viewer_status_t *viewer_status,
                                static_obstacles_list_t *obstacles);
@@ -88,6 +95,52 @@ static void copy_prebuilt_graph(dj_graph_builder_t *builder, dj_graph_graph_t *p
         dj_control_non_null(new_link, );
         new_link->m_enabled = prebuild_link->m_enabled;
     }
+
+    builder->m_nb_prebuilt_nodes = nb_nodes;
+    builder->m_nb_prebuilt_links = nb_links;
+}
+
+/**
+ * @brief Function to restore the copy of the prebuilt graph kept in the builder's graph
+ * @note The nodes and links added after the copy are removed, the enabled flags are copied again
+ * @pre The prebuilt graph must be the same as the one copied by copy_prebuilt_graph
+ *
+ * @param builder Builder of the graph to rebuild
+ * @param prebuilt_graph Prebuilt graph copied
+ */
+static void restore_prebuilt_graph(dj_graph_builder_t *builder, dj_graph_graph_t *prebuilt_graph)
+{
+    dj_control_non_null(builder, );
+    dj_control_non_null(prebuilt_graph, );
+
+    // The prebuilt graph is never empty, else it is copied again
+    if (builder->m_nb_prebuilt_nodes == 0 || builder->m_nb_prebuilt_links == 0)
+    {
+        copy_prebuilt_graph(builder, prebuilt_graph);
+        return;
+    }
+
+    // Remove the nodes and links added after the copy (start, end, targets and rebuilt ones)
+    dj_graph_graph_t *graph = &builder->m_graph;
+    graph->last_prebuilt_node = (int32_t)builder->m_nb_prebuilt_nodes - 1;
+    graph->last_prebuilt_link = (int32_t)builder->m_nb_prebuilt_links - 1;
+    dj_graph_graph_clear_without_prebuilt(graph);
+    graph->start = NULL;
+    graph->end = NULL;
+
+    // The nodes and links may have been disabled by the dynamic obstacles
+    for (uint32_t node_index = 0; node_index < builder->m_nb_prebuilt_nodes; node_index++)
+    {
+        dj_graph_node_t *node = dj_graph_graph_get_node(graph, node_index);
+        dj_control_non_null(node, );
+        node->m_enabled = dj_graph_graph_get_node(prebuilt_graph, node_index)->m_enabled;
+    }
+    for (uint32_t link_index = 0; link_index < builder->m_nb_prebuilt_links; link_index++)
+    {
+        dj_graph_link_t *link = dj_graph_graph_get_link(graph, link_index);
+        dj_control_non_null(link, );
+        link->m_enabled = dj_graph_graph_get_link(prebuilt_graph, link_index)->m_enabled;
+    }
 }
 
 /**
@@ -124,6 +177,37 @@ static void enable_all_links_and_nodes(dj_graph_builder_t *builder)
     dj_mark_end_time(DJ_MARK_REBUILD_ENABLE_ALL);
 }
 
+/**
+ * @brief Function to save the enabled flags of the links of the first rebuild (prebuilt, start and end links)
+ * @note The flags are saved once, before the dynamic obstacles disable some of these links
+ * @see dj_graph_builder_restore_first_rebuild
+ *
+ * @param builder The graph builder
+ */
+static void save_first_rebuild_links(dj_graph_builder_t *builder)
+{
+    dj_control_non_null(builder, );
+
+    if (builder->m_links_saved)
+    {
+        return;
+    }
+
+    memset(builder->m_saved_links, 0, sizeof(builder->m_saved_links));
+    uint32_t nb_links = (uint32_t)(builder->m_graph.last_prebuilt_link + 1);
+    for (uint32_t link_index = 0; link_index < nb_links; link_index++)
+    {
+        dj_graph_link_t *link = dj_graph_graph_get_link(&builder->m_graph, link_index);
+        dj_control_non_null(link, );
+        if (link->m_enabled)
+        {
+            builder->m_saved_links[link_index / 8] |= (uint8_t)(1u << (link_index % 8));
+        }
+    }
+    builder->m_links_saved = true;
+}
+
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
 /**
  * @brief Disable all the links which are on the solution of dynamic obstacles
  * @warning A link connected to the viewer should not be disabled
@@ -157,11 +241,67 @@ static void disable_links_on_solution(dj_graph_builder_t *builder,
         }
 
         // Rbuild the graph with the obstacle
-        dj_graph_builder_build_with_obstacle(builder, obstacle, viewer_status, false, !DJ_ENABLE_REBUILD_OPTIMIZATION);
+        builder->m_nb_blocked_links += dj_graph_builder_build_with_obstacle(
+            builder, obstacle, viewer_status, false, !builder->m_enable_rebuild_optimization);
+    }
+
+    dj_mark_end_time(DJ_MARK_REBUILD_DISABLE_LINKS);
+}
+
+#elif (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+MAGIC_ARRAY_SRC(blocked_links_list, dj_graph_link_t *)
+
+/**
+ * @brief Disable all the links leaving the viewer which are blocked by a dynamic obstacle in space time
+ * @note The links disabled from the previous viewer are enabled again first
+ * @see dj_obstacle_manager_is_segment_blocked
+ *
+ * @param builder The graph builder
+ * @param viewer_status The viewer status
+ */
+static void disable_links_in_space_time(dj_graph_builder_t *builder, dj_viewer_status_t *viewer_status)
+{
+    dj_control_non_null(builder, );
+
+    dj_mark_start_time(DJ_MARK_REBUILD_DISABLE_LINKS);
+
+    // Enable the links disabled from the previous viewer
+    for (uint32_t i = 0; i < blocked_links_list_size(&builder->m_blocked_links); i++)
+    {
+        dj_graph_link_t **link = blocked_links_list_get(&builder->m_blocked_links, i);
+        dj_control_non_null(link, );
+        dj_graph_link_enable(*link, true);
+    }
+    blocked_links_list_clear(&builder->m_blocked_links);
+
+    if (viewer_status == NULL)
+    {
+        dj_mark_end_time(DJ_MARK_REBUILD_DISABLE_LINKS);
+        return;
+    }
+
+    // Check all the links leaving the viewer
+    uint32_t nb_links = dj_graph_graph_get_num_links(&builder->m_graph);
+    for (uint32_t link_index = 0; link_index < nb_links; link_index++)
+    {
+        dj_graph_link_t *link = dj_graph_graph_get_link(&builder->m_graph, link_index);
+        dj_control_non_null(link, );
+        dj_graph_node_t *other_node = dj_graph_link_is_connected_to_pos(link, &viewer_status->m_position);
+        if (other_node == NULL)
+        {
+            continue;
+        }
+        if (dj_obstacle_manager_is_segment_blocked(&builder->m_obstacle_manager, viewer_status, &other_node->m_pos))
+        {
+            dj_graph_link_enable(link, false);
+            blocked_links_list_add(&builder->m_blocked_links, &link);
+            builder->m_nb_blocked_links++;
+        }
     }
 
     dj_mark_end_time(DJ_MARK_REBUILD_DISABLE_LINKS);
 }
+#endif
 
 /**
  * @brief Function to add the viewer as a node in the graph (if it is not already present)
@@ -240,6 +380,8 @@ void dj_graph_builder_rebuild(dj_graph_builder_t *builder,
 
     // Clear the graph (only nodes and links generated by dynamic obstacles)
     dj_graph_graph_clear_without_prebuilt(&builder->m_graph);
+    // Save the links of the first rebuild before the dynamic obstacles disable some of them
+    save_first_rebuild_links(builder);
     // Enable all the nodes and links
     enable_all_links_and_nodes(builder);
     // Copy all the nodes wich are not on solution of dynamic obstacles
@@ -271,8 +413,13 @@ void dj_graph_builder_rebuild(dj_graph_builder_t *builder,
     dj_debug_printf("Number of nodes in the prebuilt graph: %d\n", (int)nb_nodes_prebuilt_graph);
 #endif
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
     // Disable all the links which are on the solution of dynamic obstacles
     disable_links_on_solution(builder, obstacles, viewer_status);
+#elif (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+    // Enable the links disabled from the previous viewer and disable the ones blocked from the new viewer
+    disable_links_in_space_time(builder, viewer_status);
+#endif
 
     // Add the viewer as a node in the graph
     add_viewer_as_node(builder, viewer_status, obstacles);
@@ -287,6 +434,7 @@ void dj_graph_builder_rebuild(dj_graph_builder_t *builder,
 
 void dj_graph_builder_first_rebuild(dj_graph_builder_t *builder,
                                     dj_graph_graph_t *prebuilt_graph,
+                                    uint32_t prebuilt_version,
                                     GEOMETRY_point_t start,
                                     GEOMETRY_point_t end)
 {
@@ -295,8 +443,23 @@ void dj_graph_builder_first_rebuild(dj_graph_builder_t *builder,
         return;
     }
     dj_mark_start_time(DJ_MARK_FIRST_REBUILD);
-    // Copy the prebuilt graph
-    copy_prebuilt_graph(builder, prebuilt_graph);
+    // Copy the prebuilt graph (or restore the copy of the previous first rebuild if the prebuilt graph is the same)
+    if (prebuilt_version != 0 && builder->m_prebuilt_version == prebuilt_version)
+    {
+        restore_prebuilt_graph(builder, prebuilt_graph);
+    }
+    else
+    {
+        copy_prebuilt_graph(builder, prebuilt_graph);
+        builder->m_prebuilt_version = prebuilt_version;
+    }
+    // The obstacles may have been enabled or disabled since the previous first rebuild
+    dj_obstacle_manager_clear_obstacles(&builder->m_obstacle_manager);
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+    blocked_links_list_clear(&builder->m_blocked_links);
+#endif
+    builder->m_links_saved = false;
+    builder->m_nb_blocked_links = 0;
 
     // Add the start and end nodes
     dj_graph_node_t start_node;
@@ -326,4 +489,54 @@ void dj_graph_builder_first_rebuild(dj_graph_builder_t *builder,
 #endif
 }
 
+void dj_graph_builder_add_target(dj_graph_builder_t *builder, GEOMETRY_point_t target)
+{
+    dj_control_non_null(builder, );
+
+    // The target can already be a node of the graph (e.g. the end node)
+    if (dj_graph_graph_get_node_from_pos(&builder->m_graph, &target) != NULL)
+    {
+        return;
+    }
+
+    // Add the target node as a prebuilt node to keep it during the rebuilds
+    dj_graph_node_t target_node;
+    dj_graph_node_init(&target_node, &target);
+    dj_graph_node_t *target_node_in_graph
+        = dj_graph_graph_add_node(&builder->m_graph, &target_node, DJ_GRAPH_NODE_TYPE_PREBUILT);
+    dj_graph_node_deinit(&target_node);
+    dj_control_non_null(target_node_in_graph, );
+
+    // Link the target node
+    static_obstacles_list_t *obstacles = dj_obstacle_manager_get_all_obstacles(&builder->m_obstacle_manager, NULL);
+    dj_graph_builder_force_link_node(builder, target_node_in_graph, obstacles, true, DJ_ENABLE_REBUILD_GRAPH_DEBUG_LOGS);
+}
+
+void dj_graph_builder_restore_first_rebuild(dj_graph_builder_t *builder)
+{
+    dj_control_non_null(builder, );
+
+    // Clear the nodes and links added by the rebuilds
+    dj_graph_graph_clear_without_prebuilt(&builder->m_graph);
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+    blocked_links_list_clear(&builder->m_blocked_links);
+#endif
+
+    // Enable again the links of the first rebuild disabled by the dynamic obstacles
+    if (builder->m_links_saved)
+    {
+        uint32_t nb_links = (uint32_t)(builder->m_graph.last_prebuilt_link + 1);
+        for (uint32_t link_index = 0; link_index < nb_links; link_index++)
+        {
+            dj_graph_link_t *link = dj_graph_graph_get_link(&builder->m_graph, link_index);
+            dj_control_non_null(link, );
+            dj_graph_link_enable(link, (builder->m_saved_links[link_index / 8] & (1u << (link_index % 8))) != 0);
+        }
+    }
+    builder->m_nb_blocked_links = 0;
+
+    // The dynamic obstacles must be imported again at the next rebuild
+    dj_obstacle_manager_clear_obstacles(&builder->m_obstacle_manager);
+}
+
 /* ******************************************* Public callback functions declarations ************************************ */
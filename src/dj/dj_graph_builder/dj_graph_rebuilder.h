@@ -40,17 +40,42 @@ void dj_graph_builder_rebuild(dj_graph_builder_t *builder,
  *
  * @param builder The graph builder to rebuild
  * @param prebuilt_graph The prebuilt graph to use
+ * @param prebuilt_version Version of the prebuilt graph (0 if unknown)
  * @param start The start point of the graph
  * @param end The end point of the graph
  * @note This function is used to rebuild the graph at launch of new dj order
- * @note It is more efficient to use this function than to destroy and recreate the graph
+ * @note It is more efficient to use this function than to destroy and recreate the graph : if the builder has already
+ *       copied the same version of the prebuilt graph, the copy is restored instead of being made again
  * @post The graph will be built from the prebuilt graph with the start and end nodes
  */
 void dj_graph_builder_first_rebuild(dj_graph_builder_t *builder,
                                     dj_graph_graph_t *prebuilt_graph,
+                                    uint32_t prebuilt_version,
                                     GEOMETRY_point_t start,
                                     GEOMETRY_point_t end);
 
+/**
+ * @brief Function to add a target node to the graph
+ *
+ * @param builder The graph builder
+ * @param target The target point
+ * @note The target node is kept by the next rebuilds, as the start and end nodes
+ * @note Nothing is done if a node already exists at the target point
+ * @pre The graph must be rebuilt with dj_graph_builder_first_rebuild
+ */
+void dj_graph_builder_add_target(dj_graph_builder_t *builder, GEOMETRY_point_t target);
+
+/**
+ * @brief Function to restore the graph of the first rebuild
+ *
+ * @param builder The graph builder
+ * @note The nodes and links added by the rebuilds are removed and the links of the first rebuild disabled by the
+ *       dynamic obstacles are enabled again, so another search can start without copying and linking the graph again
+ *       (e.g. without the dynamic obstacles, see dj_obstacle_manager_enable_dynamic_obstacles)
+ * @pre The graph must be rebuilt with dj_graph_builder_first_rebuild
+ */
+void dj_graph_builder_restore_first_rebuild(dj_graph_builder_t *builder);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -9,6 +9,7 @@
 /* ******************************************************* Includes ****************************************************** */
 
 #include "dj_prebuilt_graph.h"
+#include "../dj_graph/dj_graph_link.h"
 #include "../dj_graph/dj_graph_node.h"
 #include "../dj_obstacle/dj_polygon.h"
 #include "dj_graph_builder.h"
@@ -16,16 +17,396 @@
 
 /* **************************************************** Private macros *************************************************** */
 
+#if (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_FULL)
+#define PREBUILT_TABLE_UNREACHABLE (UINT32_MAX)
+#elif (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_COMPACT)
+#define PREBUILT_TABLE_UNREACHABLE (UINT16_MAX)
+#if (DJ_PREBUILT_TABLE_MAX_NODES > 256)
+#error "The next hops of the compact table are stored on 8 bits"
+#endif
+#endif
+
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+/**
+ * @brief Number of buckets of the hash map of the prebuilt nodes (indexed by their position)
+ */
+#define PREBUILT_NODES_HASH_BUCKETS (2 * DJ_GRAPH_GRAPH_MAX_NODES)
+#endif
+
 /* ************************************************ Private type definition ********************************************** */
 
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+#if (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_FULL)
+typedef uint32_t prebuilt_table_distance_t;
+typedef uint16_t prebuilt_table_hop_t;
+#else
+typedef uint16_t prebuilt_table_distance_t;
+typedef uint8_t prebuilt_table_hop_t;
+#endif
+
+/**
+ * @brief Shortest paths between all the prebuilt nodes
+ * @note The paths are the shortest ones and not the fastest ones : the duration of a segment depends on the previous
+ *       one (speed and angle at the junction), so the durations can't be combined.
+ */
+typedef struct
+{
+    /**
+     * @brief Length of the shortest path between two nodes (mm, PREBUILT_TABLE_UNREACHABLE if there is no path)
+     */
+    prebuilt_table_distance_t m_distances[DJ_PREBUILT_TABLE_MAX_NODES][DJ_PREBUILT_TABLE_MAX_NODES];
+    /**
+     * @brief Node which follows the first one in the shortest path between two nodes
+     */
+    prebuilt_table_hop_t m_next_hops[DJ_PREBUILT_TABLE_MAX_NODES][DJ_PREBUILT_TABLE_MAX_NODES];
+    /**
+     * @brief Number of nodes of the table (the nodes of the prebuilt graph)
+     */
+    uint32_t m_nb_nodes;
+    /**
+     * @brief Flag to know if the table is up to date with the prebuilt graph
+     */
+    bool m_is_valid;
+} prebuilt_table_t;
+#endif
+
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+/**
+ * @brief Landmarks of the prebuilt graph
+ */
+typedef struct
+{
+    /**
+     * @brief Length of the shortest path from each landmark to each prebuilt node (mm, UINT32_MAX if there is no path)
+     */
+    uint32_t m_distances[DJ_GRAPH_GRAPH_MAX_NODES][DJ_PREBUILT_NB_LANDMARKS];
+    /**
+     * @brief First prebuilt node of each bucket of the hash map (-1 for none)
+     */
+    int16_t m_buckets[PREBUILT_NODES_HASH_BUCKETS];
+    /**
+     * @brief Next prebuilt node in the same bucket of the hash map (-1 for none)
+     */
+    int16_t m_next_indexes[DJ_GRAPH_GRAPH_MAX_NODES];
+    /**
+     * @brief Number of prebuilt nodes
+     */
+    uint32_t m_nb_nodes;
+} prebuilt_landmarks_t;
+#endif
+
 /* ********************************************* Private functions declarations ****************************************** */
 
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+static void compute_table();
+static dj_graph_node_t *get_linked_node(dj_graph_graph_t *graph, dj_graph_link_t *link, dj_graph_node_t *node);
+static uint32_t get_table_entries(dj_graph_graph_t *graph,
+                                  dj_graph_node_t *node,
+                                  dj_graph_node_t *other_end,
+                                  dj_prebuilt_table_entry_t *entries,
+                                  dj_graph_node_t **direct_via_node);
+#endif
+
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+static void compute_distances_from_node(uint32_t source_index, uint32_t *distances);
+static void compute_landmarks();
+#endif
+
 /* ************************************************** Private variables ************************************************** */
 
 static dj_graph_builder_t prebuilt_graph DJ_DEP_HEAP_VARS_SUFFIX;
 
+/**
+ * @brief Version of the prebuilt graph, incremented each time it is built or updated
+ * @note The graph builders keep their copy of the prebuilt graph while the version is the same
+ */
+static uint32_t prebuilt_graph_version = 0;
+
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+static prebuilt_table_t prebuilt_table DJ_DEP_HEAP_VARS_SUFFIX;
+#endif
+
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+static prebuilt_landmarks_t prebuilt_landmarks DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief Distances of the search from one node (used to compute the landmarks)
+ * @note These arrays are global to avoid stack overflow
+ */
+static uint32_t search_distances[DJ_GRAPH_GRAPH_MAX_NODES] DJ_DEP_HEAP_VARS_SUFFIX;
+static uint32_t min_landmark_distances[DJ_GRAPH_GRAPH_MAX_NODES] DJ_DEP_HEAP_VARS_SUFFIX;
+#endif
+
 /* ********************************************** Private functions definitions ****************************************** */
 
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+/**
+ * @brief Function to compute the shortest paths between all the prebuilt nodes (Floyd-Warshall algorithm)
+ * @post The table is valid if the prebuilt graph isn't too big
+ */
+static void compute_table()
+{
+    dj_graph_graph_t *graph = &prebuilt_graph.m_graph;
+    prebuilt_table.m_is_valid = false;
+    prebuilt_table.m_nb_nodes = dj_graph_graph_get_num_nodes(graph);
+    if (prebuilt_table.m_nb_nodes > DJ_PREBUILT_TABLE_MAX_NODES)
+    {
+        dj_info_printf("DJ : Too many prebuilt nodes (%d) for the shortest paths table\n", (int)prebuilt_table.m_nb_nodes);
+        return;
+    }
+    uint32_t nb_nodes = prebuilt_table.m_nb_nodes;
+
+    // Without any link, the nodes can only reach themselves
+    for (uint32_t i = 0; i < nb_nodes; i++)
+    {
+        for (uint32_t j = 0; j < nb_nodes; j++)
+        {
+            prebuilt_table.m_distances[i][j] = (i == j) ? 0 : PREBUILT_TABLE_UNREACHABLE;
+            prebuilt_table.m_next_hops[i][j] = (prebuilt_table_hop_t)j;
+        }
+    }
+
+    // The links are the paths with only one segment
+    dj_graph_node_t *first_node = dj_graph_graph_get_node(graph, 0);
+    for (uint32_t link_index = 0; link_index < dj_graph_graph_get_num_links(graph); link_index++)
+    {
+        dj_graph_link_t *link = dj_graph_graph_get_link(graph, link_index);
+        dj_control_non_null(link, );
+        dj_graph_node_t *node1 = dj_graph_link_get_node1(link);
+        dj_graph_node_t *node2 = dj_graph_link_get_node2(link);
+        if (!link->m_enabled || !node1->m_enabled || !node2->m_enabled)
+        {
+            continue;
+        }
+        uint32_t index1 = (uint32_t)(node1 - first_node);
+        uint32_t index2 = (uint32_t)(node2 - first_node);
+        prebuilt_table_distance_t distance = GEOMETRY_distance(node1->m_pos, node2->m_pos);
+        prebuilt_table.m_distances[index1][index2] = distance;
+        prebuilt_table.m_distances[index2][index1] = distance;
+    }
+
+    // Allow the paths to go through each node one by one
+    for (uint32_t k = 0; k < nb_nodes; k++)
+    {
+        for (uint32_t i = 0; i < nb_nodes; i++)
+        {
+            if (prebuilt_table.m_distances[i][k] == PREBUILT_TABLE_UNREACHABLE)
+            {
+                continue;
+            }
+            for (uint32_t j = 0; j < nb_nodes; j++)
+            {
+                // The paths too long for the compact table are ignored
+                uint32_t distance = (uint32_t)prebuilt_table.m_distances[i][k] + prebuilt_table.m_distances[k][j];
+                if (prebuilt_table.m_distances[k][j] != PREBUILT_TABLE_UNREACHABLE
+                    && distance < prebuilt_table.m_distances[i][j])
+                {
+                    prebuilt_table.m_distances[i][j] = (prebuilt_table_distance_t)distance;
+                    prebuilt_table.m_next_hops[i][j] = prebuilt_table.m_next_hops[i][k];
+                }
+            }
+        }
+    }
+
+    prebuilt_table.m_is_valid = true;
+}
+
+/**
+ * @brief Function to get the node linked to a node by a link
+ * @note The extraction nodes are often at the same position as a prebuilt node, the prebuilt node is returned then
+ *
+ * @param graph Graph of the link
+ * @param link Link to follow
+ * @param node Node at one end of the link
+ * @return dj_graph_node_t* Node at the other end of the link, or NULL if the link isn't usable
+ */
+static dj_graph_node_t *get_linked_node(dj_graph_graph_t *graph, dj_graph_link_t *link, dj_graph_node_t *node)
+{
+    dj_graph_node_t *linked_node = dj_graph_link_is_connected_to_pos(link, &node->m_pos);
+    if (linked_node == NULL || !linked_node->m_enabled)
+    {
+        return NULL;
+    }
+    // The first node at a position is the prebuilt one
+    return dj_graph_graph_get_node_from_pos(graph, &linked_node->m_pos);
+}
+
+/**
+ * @brief Function to get the prebuilt nodes linked to the start (or to the end) of a path
+ * @note The node can be linked to the prebuilt nodes through the node which extracts it from an obstacle
+ *
+ * @param graph Graph which contains the node
+ * @param node Start (or end) node
+ * @param other_end End (or start) node
+ * @param [out] entries Prebuilt nodes linked to the node (DJ_PREBUILT_TABLE_MAX_NODES at most)
+ * @param [out] direct_via_node Node through which the node is linked to the other end, or NULL
+ * @return uint32_t Number of entries
+ */
+static uint32_t get_table_entries(dj_graph_graph_t *graph,
+                                  dj_graph_node_t *node,
+                                  dj_graph_node_t *other_end,
+                                  dj_prebuilt_table_entry_t *entries,
+                                  dj_graph_node_t **direct_via_node)
+{
+    uint32_t nb_links = dj_graph_graph_get_num_links(graph);
+    dj_graph_node_t *first_node = dj_graph_graph_get_node(graph, 0);
+    uint32_t nb_entries = 0;
+    *direct_via_node = NULL;
+    for (uint32_t link_index = 0; link_index < nb_links && nb_entries < DJ_PREBUILT_TABLE_MAX_NODES; link_index++)
+    {
+        dj_graph_node_t *neighbor = get_linked_node(graph, dj_graph_graph_get_link(graph, link_index), node);
+        if (neighbor == NULL || neighbor == other_end)
+        {
+            continue;
+        }
+        uint32_t neighbor_distance = GEOMETRY_distance(node->m_pos, neighbor->m_pos);
+        uint32_t neighbor_index = (uint32_t)(neighbor - first_node);
+        if (neighbor_index < prebuilt_table.m_nb_nodes)
+        {
+            entries[nb_entries++] = (dj_prebuilt_table_entry_t){neighbor_index, NULL, neighbor_distance};
+            continue;
+        }
+
+        // The neighbor isn't prebuilt, it is the node which extracts the node from an obstacle
+        for (uint32_t via_link_index = 0; via_link_index < nb_links && nb_entries < DJ_PREBUILT_TABLE_MAX_NODES;
+             via_link_index++)
+        {
+            dj_graph_node_t *via_neighbor = get_linked_node(graph, dj_graph_graph_get_link(graph, via_link_index), neighbor);
+            if (via_neighbor == NULL)
+            {
+                continue;
+            }
+            if (via_neighbor == other_end)
+            {
+                *direct_via_node = neighbor;
+                continue;
+            }
+            uint32_t via_neighbor_index = (uint32_t)(via_neighbor - first_node);
+            if (via_neighbor_index < prebuilt_table.m_nb_nodes)
+            {
+                uint32_t distance = neighbor_distance + GEOMETRY_distance(neighbor->m_pos, via_neighbor->m_pos);
+                entries[nb_entries++] = (dj_prebuilt_table_entry_t){via_neighbor_index, neighbor, distance};
+            }
+        }
+    }
+    return nb_entries;
+}
+#endif
+
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+/**
+ * @brief Function to compute the lengths of the shortest paths from a prebuilt node to all the others (Dijkstra)
+ *
+ * @param source_index Index of the node
+ * @param [out] distances Length of the shortest path to each node (UINT32_MAX if there is no path)
+ */
+static void compute_distances_from_node(uint32_t source_index, uint32_t *distances)
+{
+    static bool is_settled[DJ_GRAPH_GRAPH_MAX_NODES];
+    dj_graph_graph_t *graph = &prebuilt_graph.m_graph;
+    dj_graph_node_t *first_node = dj_graph_graph_get_node(graph, 0);
+    uint32_t nb_nodes = prebuilt_landmarks.m_nb_nodes;
+    uint32_t nb_links = dj_graph_graph_get_num_links(graph);
+    for (uint32_t i = 0; i < nb_nodes; i++)
+    {
+        distances[i] = UINT32_MAX;
+        is_settled[i] = false;
+    }
+    distances[source_index] = 0;
+
+    while (true)
+    {
+        // Settle the closest node
+        int32_t current_index = -1;
+        for (uint32_t i = 0; i < nb_nodes; i++)
+        {
+            if (!is_settled[i] && distances[i] != UINT32_MAX
+                && (current_index == -1 || distances[i] < distances[current_index]))
+            {
+                current_index = i;
+            }
+        }
+        if (current_index == -1)
+        {
+            return;
+        }
+        is_settled[current_index] = true;
+
+        // Relax its links
+        dj_graph_node_t *current_node = dj_graph_graph_get_node(graph, current_index);
+        for (uint32_t link_index = 0; link_index < nb_links; link_index++)
+        {
+            dj_graph_node_t *neighbor
+                = dj_graph_link_is_connected_to_pos(dj_graph_graph_get_link(graph, link_index), &current_node->m_pos);
+            if (neighbor == NULL || !neighbor->m_enabled || !current_node->m_enabled)
+            {
+                continue;
+            }
+            uint32_t neighbor_index = (uint32_t)(neighbor - first_node);
+            uint32_t distance = distances[current_index] + GEOMETRY_distance(current_node->m_pos, neighbor->m_pos);
+            if (distance < distances[neighbor_index])
+            {
+                distances[neighbor_index] = distance;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Function to choose the landmarks and to compute their distances to all the prebuilt nodes
+ * @note Each landmark is the node the farthest from the previous ones, so that the landmarks surround the graph
+ */
+static void compute_landmarks()
+{
+    dj_graph_graph_t *graph = &prebuilt_graph.m_graph;
+    prebuilt_landmarks.m_nb_nodes = dj_graph_graph_get_num_nodes(graph);
+    uint32_t nb_nodes = prebuilt_landmarks.m_nb_nodes;
+
+    // Index the nodes by their position
+    for (uint32_t i = 0; i < PREBUILT_NODES_HASH_BUCKETS; i++)
+    {
+        prebuilt_landmarks.m_buckets[i] = -1;
+    }
+    for (uint32_t i = 0; i < nb_nodes; i++)
+    {
+        uint32_t bucket = dj_graph_node_get_bucket(&dj_graph_graph_get_node(graph, i)->m_pos, PREBUILT_NODES_HASH_BUCKETS);
+        prebuilt_landmarks.m_next_indexes[i] = prebuilt_landmarks.m_buckets[bucket];
+        prebuilt_landmarks.m_buckets[bucket] = (int16_t)i;
+    }
+    if (nb_nodes == 0)
+    {
+        return;
+    }
+
+    // The first landmark is the farthest node from the first node
+    compute_distances_from_node(0, min_landmark_distances);
+    for (uint32_t landmark = 0; landmark < DJ_PREBUILT_NB_LANDMARKS; landmark++)
+    {
+        uint32_t landmark_index = 0;
+        for (uint32_t i = 0; i < nb_nodes; i++)
+        {
+            if (min_landmark_distances[i] != UINT32_MAX
+                && min_landmark_distances[i] > min_landmark_distances[landmark_index])
+            {
+                landmark_index = i;
+            }
+        }
+        dj_debug_printf("Landmark %d : node %d\n", (int)landmark, (int)landmark_index);
+
+        compute_distances_from_node(landmark_index, search_distances);
+        for (uint32_t i = 0; i < nb_nodes; i++)
+        {
+            prebuilt_landmarks.m_distances[i][landmark] = search_distances[i];
+            // The next landmark is the farthest node from all the landmarks
+            if (landmark == 0 || search_distances[i] < min_landmark_distances[i])
+            {
+                min_landmark_distances[i] = search_distances[i];
+            }
+        }
+    }
+}
+#endif
+
 /* *********************************************** Public functions declarations ***************************************** */
 
 void dj_prebuilt_graph_init()
@@ -34,10 +415,23 @@ void dj_prebuilt_graph_init()
     // Build the graph
     dj_debug_printf("Build prebuilt graph\n");
     dj_graph_builder_build_all(&prebuilt_graph, NULL, true);
+    prebuilt_graph_version++;
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+    compute_table();
+#endif
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+    compute_landmarks();
+#endif
 }
 
 void dj_prebuilt_graph_deinit()
 {
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+    prebuilt_table.m_is_valid = false;
+#endif
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+    prebuilt_landmarks.m_nb_nodes = 0;
+#endif
     dj_graph_builder_deinit(&prebuilt_graph);
 }
 
@@ -51,7 +445,7 @@ void rebuild_graph_with_prebuilt_graph(dj_graph_builder_t *graph_builder, dj_vie
 void first_rebuild_graph_with_prebuilt_graph(dj_graph_builder_t *builder, GEOMETRY_point_t start, GEOMETRY_point_t end)
 {
     dj_control_non_null(builder, );
-    dj_graph_builder_first_rebuild(builder, &prebuilt_graph.m_graph, start, end);
+    dj_graph_builder_first_rebuild(builder, &prebuilt_graph.m_graph, prebuilt_graph_version, start, end);
 }
 
 void update_prebuilt_graph_on_obstacle_enabling(dj_obstacle_static_t *obstacle, bool enable)
@@ -72,6 +466,150 @@ void update_prebuilt_graph_on_obstacle_enabling(dj_obstacle_static_t *obstacle,
         // Rebuild the graph without the obstacle
         dj_graph_builder_build_without_obstacle(&prebuilt_graph, obstacle, NULL, true);
     }
+    prebuilt_graph_version++;
+
+#if (DJ_PREBUILT_TABLE_MODE != DJ_PREBUILT_TABLE_MODE_NONE)
+    // The shortest paths depend on the obstacles
+    compute_table();
+#endif
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+    compute_landmarks();
+#endif
+}
+
+const uint32_t *dj_prebuilt_graph_get_landmark_distances(const GEOMETRY_point_t *position)
+{
+    dj_control_non_null(position, NULL);
+#if (DJ_PREBUILT_NB_LANDMARKS > 0)
+    if (prebuilt_landmarks.m_nb_nodes == 0)
+    {
+        return NULL;
+    }
+    uint32_t bucket = dj_graph_node_get_bucket(position, PREBUILT_NODES_HASH_BUCKETS);
+    for (int16_t i = prebuilt_landmarks.m_buckets[bucket]; i != -1; i = prebuilt_landmarks.m_next_indexes[i])
+    {
+        GEOMETRY_point_t *node_position = &dj_graph_graph_get_node(&prebuilt_graph.m_graph, i)->m_pos;
+        if (node_position->x == position->x && node_position->y == position->y)
+        {
+            return prebuilt_landmarks.m_distances[i];
+        }
+    }
+#endif
+    return NULL;
+}
+
+bool get_static_path_with_prebuilt_table(dj_graph_builder_t *builder,
+                                         dj_prebuilt_table_entries_t *entries,
+                                         dj_graph_path_t *path)
+{
+    dj_control_non_null(builder, false);
+    dj_control_non_null(entries, false);
+    dj_control_non_null(path, false);
+#if (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_NONE)
+    return false;
+#else
+    if (!prebuilt_table.m_is_valid)
+    {
+        return false;
+    }
+
+    dj_graph_graph_t *graph = &builder->m_graph;
+    dj_graph_node_t *start_node = dj_graph_graph_get_start(graph);
+    dj_graph_node_t *end_node = dj_graph_graph_get_end(graph);
+    dj_control_non_null(start_node, false);
+    dj_control_non_null(end_node, false);
+
+    /*
+        The start and the end are linked to the prebuilt nodes they see.
+        The shortest path is the best combination of an entry from the start, a path of the table and an entry to
+        the end. The path can also avoid the prebuilt nodes (direct link or through an extraction node).
+    */
+    dj_graph_node_t *start_via_node;
+    dj_graph_node_t *end_via_node;
+    dj_prebuilt_table_entry_t *start_entries = entries->m_start_entries;
+    dj_prebuilt_table_entry_t *end_entries = entries->m_end_entries;
+    uint32_t nb_start_entries = get_table_entries(graph, start_node, end_node, start_entries, &start_via_node);
+    uint32_t nb_end_entries = get_table_entries(graph, end_node, start_node, end_entries, &end_via_node);
+
+    uint32_t best_distance = UINT32_MAX;
+    dj_prebuilt_table_entry_t *best_start_entry = NULL;
+    dj_prebuilt_table_entry_t *best_end_entry = NULL;
+    dj_graph_node_t *best_via_node = NULL;
+    dj_graph_link_t *direct_link = dj_graph_graph_get_link_from_nodes(graph, start_node, end_node);
+    if (direct_link != NULL && direct_link->m_enabled)
+    {
+        best_distance = GEOMETRY_distance(start_node->m_pos, end_node->m_pos);
+    }
+    dj_graph_node_t *via_nodes[] = {start_via_node, end_via_node};
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        if (via_nodes[i] != NULL)
+        {
+            uint32_t distance = GEOMETRY_distance(start_node->m_pos, via_nodes[i]->m_pos)
+                                + GEOMETRY_distance(via_nodes[i]->m_pos, end_node->m_pos);
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best_via_node = via_nodes[i];
+            }
+        }
+    }
+    for (uint32_t i = 0; i < nb_start_entries; i++)
+    {
+        for (uint32_t j = 0; j < nb_end_entries; j++)
+        {
+            prebuilt_table_distance_t table_distance
+                = prebuilt_table.m_distances[start_entries[i].m_index][end_entries[j].m_index];
+            if (table_distance == PREBUILT_TABLE_UNREACHABLE)
+            {
+                continue;
+            }
+            uint32_t distance = start_entries[i].m_distance + table_distance + end_entries[j].m_distance;
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best_start_entry = &start_entries[i];
+                best_end_entry = &end_entries[j];
+            }
+        }
+    }
+    if (best_distance == UINT32_MAX)
+    {
+        return false;
+    }
+
+    // Follow the next hops from the entry of the start to the entry of the end
+    if (best_start_entry != NULL)
+    {
+        if (best_start_entry->m_via_node != NULL
+            && dj_graph_path_add_point(path, &best_start_entry->m_via_node->m_pos) == -1)
+        {
+            return false;
+        }
+        uint32_t node_index = best_start_entry->m_index;
+        while (true)
+        {
+            if (dj_graph_path_add_point(path, &dj_graph_graph_get_node(graph, node_index)->m_pos) == -1)
+            {
+                return false;
+            }
+            if (node_index == best_end_entry->m_index)
+            {
+                break;
+            }
+            node_index = prebuilt_table.m_next_hops[node_index][best_end_entry->m_index];
+        }
+        if (best_end_entry->m_via_node != NULL && dj_graph_path_add_point(path, &best_end_entry->m_via_node->m_pos) == -1)
+        {
+            return false;
+        }
+    }
+    else if (best_via_node != NULL && dj_graph_path_add_point(path, &best_via_node->m_pos) == -1)
+    {
+        return false;
+    }
+    return dj_graph_path_add_point(path, &end_node->m_pos) != -1;
+#endif
 }
 
 /* ******************************************* Public callback functions declarations ************************************ */
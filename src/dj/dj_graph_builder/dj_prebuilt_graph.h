@@ -11,12 +11,54 @@
 
 /* ******************************************************* Includes ****************************************************** */
 
+#include "../dj_graph/dj_graph_path.h"
 #include "dj_graph_builder.h"
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Maximum number of prebuilt nodes in the table of the shortest paths (see DJ_PREBUILT_TABLE_MODE)
+ */
+#if (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_FULL)
+#define DJ_PREBUILT_TABLE_MAX_NODES (DJ_GRAPH_GRAPH_MAX_NODES)
+#elif (DJ_PREBUILT_TABLE_MODE == DJ_PREBUILT_TABLE_MODE_COMPACT)
+#define DJ_PREBUILT_TABLE_MAX_NODES (DJ_PREBUILT_TABLE_COMPACT_MAX_NODES)
+#else
+#define DJ_PREBUILT_TABLE_MAX_NODES (1)
+#endif
+
 /* ************************************************** Public types definition ******************************************** */
 
+/**
+ * @brief Way to enter (or to leave) the table from the start (or the end) of a path
+ */
+typedef struct
+{
+    /**
+     * @brief Index of the prebuilt node
+     */
+    uint32_t m_index;
+    /**
+     * @brief Node between the start (or the end) and the prebuilt node, or NULL if they are linked
+     * @note It is the node which extracts the start (or the end) from an obstacle
+     */
+    dj_graph_node_t *m_via_node;
+    /**
+     * @brief Distance between the start (or the end) and the prebuilt node (mm)
+     */
+    uint32_t m_distance;
+} dj_prebuilt_table_entry_t;
+
+/**
+ * @brief Entries of the start and of the end of a static path (see get_static_path_with_prebuilt_table)
+ * @note They are given by the caller, so the static paths of different planners can be searched at the same time
+ */
+typedef struct
+{
+    dj_prebuilt_table_entry_t m_start_entries[DJ_PREBUILT_TABLE_MAX_NODES];
+    dj_prebuilt_table_entry_t m_end_entries[DJ_PREBUILT_TABLE_MAX_NODES];
+} dj_prebuilt_table_entries_t;
+
 /* *********************************************** Public functions declarations ***************************************** */
 
 /**
@@ -66,6 +108,30 @@ void first_rebuild_graph_with_prebuilt_graph(dj_graph_builder_t *builder, GEOMET
  */
 void update_prebuilt_graph_on_obstacle_enabling(dj_obstacle_static_t *obstacle, bool enable);
 
+/**
+ * @brief Function to get a static path with the shortest paths between the prebuilt nodes
+ *
+ * @param builder The graph builder (only the static obstacles must be enabled)
+ * @param entries Memory used to search the path
+ * @param [out] path The path (initialized with the start status)
+ * @return true if a path has been found, false otherwise (or if the table is disabled, see DJ_PREBUILT_TABLE_MODE)
+ * @note The path is the shortest one and not the fastest one, it may be a bit slower than the one found by the solver
+ * @pre The graph must be rebuilt with first_rebuild_graph_with_prebuilt_graph
+ */
+bool get_static_path_with_prebuilt_table(dj_graph_builder_t *builder,
+                                         dj_prebuilt_table_entries_t *entries,
+                                         dj_graph_path_t *path);
+
+/**
+ * @brief Function to get the lengths of the shortest paths from the landmarks to a prebuilt node
+ * @see DJ_PREBUILT_NB_LANDMARKS
+ *
+ * @param position Position of the prebuilt node
+ * @return const uint32_t* Length from each landmark (mm, UINT32_MAX if there is no path), or NULL if the position
+ *         isn't a prebuilt node (or if the landmarks are disabled)
+ */
+const uint32_t *dj_prebuilt_graph_get_landmark_distances(const GEOMETRY_point_t *position);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -3,67 +3,253 @@
 #include "../dj_dependencies/dj_dependencies.h"
 #include "../dj_graph/dj_graph_path.h"
 #include "../dj_graph_builder/dj_graph_builder.h"
+#include "../dj_graph_builder/dj_graph_rebuilder.h"
 #include "../dj_graph_builder/dj_prebuilt_graph.h"
 #include "../dj_logs/dj_logs.h"
 #include "../dj_logs/dj_time_marker.h"
-#include "../dj_obstacle_importer/dj_obstacle_importer.h"
+#include "../dj_obstacle/dj_obstacle_manager.h"
 #include "../dj_solver/dj_solver.h"
+#include "../dj_solver/dj_solver_dijkstra/dj_solver_dijkstra.h"
 #include "../dj_viewer/dj_viewer_status.h"
+#include "dj_plan_cache.h"
 
 #include <stdbool.h>
 
-bool dj_genarate_path_with_param(dj_graph_path_t *path, GEOMETRY_point_t target_point, bool enable_dynamic_obstacles)
+/**
+ * @brief Planner of the queries without planner
+ * @note It is global to avoid stack overflow
+ */
+static dj_planner_t default_planner DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief True if the default planner is initialized
+ */
+static bool default_planner_initialized = false;
+
+/**
+ * @brief Function to get the planner of a query
+ *
+ * @param [in] planner The planner given to the query (NULL for the default planner)
+ *
+ * @return dj_planner_t* The planner
+ */
+static dj_planner_t *get_planner(dj_planner_t *planner)
 {
-    dj_control_non_null(path, false);
+    if (planner != NULL)
+    {
+        return planner;
+    }
+    if (!default_planner_initialized)
+    {
+        dj_planner_init(&default_planner);
+        default_planner_initialized = true;
+    }
+    return &default_planner;
+}
 
-    dj_mark_reset_all();
-    dj_mark_start_time(DJ_MARK_ALL);
+/**
+ * @brief Function to get the graph builder of a planner, rebuilt the first time for a new path
+ *
+ * @param [in] planner The planner
+ * @param [in] start_point The start point of the path
+ * @param [in] target_point The target point of the path
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ *
+ * @return dj_graph_builder_t* The graph builder
+ */
+static dj_graph_builder_t *get_first_rebuilt_builder(dj_planner_t *planner,
+                                                     GEOMETRY_point_t start_point,
+                                                     GEOMETRY_point_t target_point,
+                                                     bool enable_dynamic_obstacles)
+{
+    dj_graph_builder_t *builder = &planner->m_builder;
+    builder->m_enable_rebuild_optimization = DJ_ENABLE_REBUILD_OPTIMIZATION;
 
-    GEOMETRY_point_t start_point;
-    dj_dep_get_robot_position(&start_point);
+    // Disable the dynamic obstacles for this planner only if needed
+    dj_obstacle_manager_enable_dynamic_obstacles(&builder->m_obstacle_manager, enable_dynamic_obstacles);
+
+    // Fisrt rebuild the graph with the prebuilt graph
+    first_rebuild_graph_with_prebuilt_graph(builder, start_point, target_point);
+    return builder;
+}
+
+/**
+ * @brief Function to get the current status of the robot
+ *
+ * @param [out] viewer_status Current status of the robot (must be deinitialized by the caller)
+ * @param [out] start_point Current position of the robot
+ */
+static void get_start_status(dj_viewer_status_t *viewer_status, GEOMETRY_point_t *start_point)
+{
+    dj_dep_get_robot_position(start_point);
     GEOMETRY_vector_t initial_speed;
     dj_dep_get_robot_speed(&initial_speed);
     time32_t time;
     dj_dep_get_time(&time);
 
-    dj_viewer_status_t viewer_status;
-    viewer_status_init(&viewer_status, &start_point, &initial_speed, time);
-    dj_graph_path_init(path, &viewer_status);
+    viewer_status_init(viewer_status, start_point, &initial_speed, time);
 
-    dj_debug_printf("Start of dj with these parameters:\n");
-    dj_debug_printf("Start point: (%d, %d)\n", start_point.x, start_point.y);
-    dj_debug_printf("Target point: (%d, %d)\n", target_point.x, target_point.y);
+    dj_debug_printf("Start point: (%d, %d)\n", start_point->x, start_point->y);
     dj_debug_printf("Initial speed: (%d, %d)\n", initial_speed.x, initial_speed.y);
     dj_debug_printf("Time: %d\n", (int)time);
+}
 
-    // Disable the dynamic obstacles if needed
-    dj_obstacle_importer_enable_dynamic_obstacles(enable_dynamic_obstacles);
-
-    // Create the graph builder
-    dj_graph_builder_t builder;
-    dj_graph_builder_init(&builder);
-
-    // Fisrt rebuild the graph with the prebuilt graph
-    first_rebuild_graph_with_prebuilt_graph(&builder, start_point, target_point);
-
+/**
+ * @brief Function to solve the graph of a planner with a new solver
+ *
+ * @param [in] planner The planner (its graph is rebuilt with first_rebuild_graph_with_prebuilt_graph)
+ * @param [in] config Strategy of the planner
+ * @param [in] viewer_status Start status of the path
+ * @param [in] has_budget True if the solving must be stopped at deadline_us
+ * @param [in] deadline_us Time at which the solving must be stopped (see dj_dep_get_time_us)
+ * @param [out] path The solution
+ * @param [out] bound Bound of the ratio between the duration of the path and the fastest one (can be NULL)
+ */
+static void solve_graph(dj_planner_t *planner,
+                        const dj_planner_config_t *config,
+                        dj_viewer_status_t *viewer_status,
+                        bool has_budget,
+                        uint32_t deadline_us,
+                        dj_graph_path_t *path,
+                        float *bound)
+{
     // Create the solver
     dj_solver_t solver;
-    dj_solver_init(&solver, &builder);
+    dj_solver_init(&solver, config->m_solver, &planner->m_builder, &planner->m_workspace);
+    dj_solver_set_epsilon(&solver, config->m_epsilon);
+    dj_solver_set_heuristic(&solver, config->m_heuristic);
 
     // Solve the graph
-    dj_solver_solve(&solver, &viewer_status);
+    if (has_budget)
+    {
+        dj_solver_solve_before(&solver, viewer_status, deadline_us);
+    }
+    else
+    {
+        dj_solver_solve(&solver, viewer_status);
+    }
 
     // Get the solution
     dj_solver_get_solution(&solver, path);
+    if (bound != NULL)
+    {
+        *bound = dj_solver_get_bound(&solver);
+    }
 
-    dj_graph_builder_deinit(&builder);
     dj_solver_deinit(&solver);
-    viewer_status_deinit(&viewer_status);
+}
 
-    // Check if the path is valid (if the last point is the target point)
+/**
+ * @brief Function to check if a path ends at the target point
+ *
+ * @param [in] path The path to check
+ * @param [in] target_point The target point
+ *
+ * @return true if the last point of the path is the target point, false otherwise
+ */
+static bool is_path_to_target(dj_graph_path_t *path, GEOMETRY_point_t target_point)
+{
     GEOMETRY_point_t end_point;
     dj_graph_path_get_end(path, &end_point);
-    if (end_point.x != target_point.x || end_point.y != target_point.y)
+    return end_point.x == target_point.x && end_point.y == target_point.y;
+}
+
+/**
+ * @brief Function to generate a path from the current position to the target point
+ *
+ * @param [in] planner The planner (NULL for the default planner)
+ * @param [out] path The path to generate
+ * @param [in] target_point The target point
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ * @param [in] config Strategy of the planner (NULL for the default one)
+ * @param [in] has_budget True if the generation must be stopped after budget_us
+ * @param [in] budget_us Maximum duration of the generation (us)
+ * @param [out] bound Bound of the ratio between the duration of the path and the fastest one (can be NULL)
+ * @param [in] retry_without_dynamic_obstacles If true and no path is found, search again without the dynamic obstacles
+ *                                             on the same graph (only if a dynamic obstacle has blocked a link)
+ *
+ * @return true on success, false otherwise
+ */
+static bool generate_path(dj_planner_t *planner,
+                          dj_graph_path_t *path,
+                          GEOMETRY_point_t target_point,
+                          bool enable_dynamic_obstacles,
+                          const dj_planner_config_t *config,
+                          bool has_budget,
+                          uint32_t budget_us,
+                          float *bound,
+                          bool retry_without_dynamic_obstacles)
+{
+    dj_control_non_null(path, false);
+    planner = get_planner(planner);
+
+#if DJ_ENABLE_PLAN_CACHE
+    // A path precomputed with the default strategy is returned at once (see dj_plan_cache_set_targets)
+    if (config == NULL && !has_budget && enable_dynamic_obstacles && dj_plan_cache_get_path(target_point, path))
+    {
+        return true;
+    }
+#endif
+
+    dj_planner_config_t default_config;
+    if (config == NULL)
+    {
+        dj_planner_config_init(&default_config);
+        config = &default_config;
+    }
+
+    // The budget includes the building of the graph
+    uint32_t deadline_us;
+    dj_dep_get_time_us(&deadline_us);
+    deadline_us += budget_us;
+
+    dj_mark_reset_all();
+    dj_mark_start_time(DJ_MARK_ALL);
+
+    dj_debug_printf("Start of dj with these parameters:\n");
+    dj_debug_printf("Target point: (%d, %d)\n", target_point.x, target_point.y);
+    GEOMETRY_point_t start_point;
+    dj_viewer_status_t viewer_status;
+    get_start_status(&viewer_status, &start_point);
+    dj_graph_path_init(path, &viewer_status);
+
+    // Fisrt rebuild the graph with the prebuilt graph
+    dj_graph_builder_t *builder = get_first_rebuilt_builder(planner, start_point, target_point, enable_dynamic_obstacles);
+    builder->m_enable_rebuild_optimization = config->m_enable_rebuild_optimization;
+
+    // Solve the graph
+    solve_graph(planner, config, &viewer_status, has_budget, deadline_us, path, bound);
+
+    // Retry without the dynamic obstacles on the same graph (the start and the end are already linked)
+    // If no link has been blocked by a dynamic obstacle, the graph is the same without them, so the retry would fail too
+    if (retry_without_dynamic_obstacles && enable_dynamic_obstacles && !is_path_to_target(path, target_point))
+    {
+        if (builder->m_nb_blocked_links == 0)
+        {
+            dj_info_printf("DJ : Path not found, no link blocked by the dynamic obstacles\n");
+        }
+        else
+        {
+            dj_info_printf("DJ : Path not found, trying without dynamic obstacles\n");
+            dj_graph_builder_restore_first_rebuild(builder);
+            dj_obstacle_manager_enable_dynamic_obstacles(&builder->m_obstacle_manager, false);
+            solve_graph(planner, config, &viewer_status, has_budget, deadline_us, path, bound);
+        }
+    }
+
+    // If the budget is spent before a path is found, the static path of the prebuilt table replaces the partial path
+    if (has_budget && !is_path_to_target(path, target_point) && dj_solver_common_is_deadline_reached(deadline_us))
+    {
+        dj_info_printf("DJ : Path not found in time, using the static path of the prebuilt table\n");
+        dj_graph_builder_restore_first_rebuild(builder);
+        dj_graph_path_init(path, &viewer_status);
+        get_static_path_with_prebuilt_table(builder, &planner->m_table_entries, path);
+    }
+
+    viewer_status_deinit(&viewer_status);
+
+    // Check if the path is valid (if the last point is the target point)
+    if (!is_path_to_target(path, target_point))
     {
         dj_mark_end_time(DJ_MARK_ALL);
         dj_print_all_durations();
@@ -91,17 +277,338 @@ bool dj_genarate_path_with_param(dj_graph_path_t *path, GEOMETRY_point_t target_
     return true;
 }
 
-bool dj_genarate_path(dj_graph_path_t *path, GEOMETRY_point_t target_point, bool retry_without_dynamic_obstacle)
+/**
+ * @brief Function to build the graph of the query done by slices and to start its solve
+ *
+ * @param [in] planner The planner
+ */
+static void build_plan(dj_planner_t *planner)
 {
-    bool result = dj_genarate_path_with_param(path, target_point, true);
-    if (!result && retry_without_dynamic_obstacle)
+    dj_plan_t *plan = &planner->m_plan;
+
+    // Fisrt rebuild the graph with the prebuilt graph
+    dj_graph_builder_t *builder = get_first_rebuilt_builder(
+        planner, plan->m_start_status.m_position, plan->m_target_point, plan->m_enable_dynamic_obstacles);
+    builder->m_enable_rebuild_optimization = plan->m_config.m_enable_rebuild_optimization;
+
+    // Start the solve, it is done by the next slices
+    dj_solver_init(&plan->m_solver, plan->m_config.m_solver, builder, &planner->m_workspace);
+    dj_solver_set_epsilon(&plan->m_solver, plan->m_config.m_epsilon);
+    dj_solver_set_heuristic(&plan->m_solver, plan->m_config.m_heuristic);
+    dj_solver_begin(&plan->m_solver, &plan->m_start_status);
+    plan->m_stage = DJ_PLAN_STAGE_SOLVE;
+}
+
+/**
+ * @brief Function to end the solve of the query done by slices
+ * @note The solve is started again without the dynamic obstacles if needed (see generate_path)
+ *
+ * @param [in] planner The planner
+ */
+static void end_plan_solve(dj_planner_t *planner)
+{
+    dj_plan_t *plan = &planner->m_plan;
+    dj_graph_builder_t *builder = &planner->m_builder;
+    dj_solver_get_solution(&plan->m_solver, &plan->m_path);
+
+    // Retry without the dynamic obstacles on the same graph (the start and the end are already linked)
+    if (plan->m_retry_without_dynamic_obstacles && plan->m_enable_dynamic_obstacles
+        && !is_path_to_target(&plan->m_path, plan->m_target_point) && builder->m_nb_blocked_links != 0)
     {
         dj_info_printf("DJ : Path not found, trying without dynamic obstacles\n");
-        result = dj_genarate_path_with_param(path, target_point, false);
+        dj_graph_builder_restore_first_rebuild(builder);
+        dj_obstacle_manager_enable_dynamic_obstacles(&builder->m_obstacle_manager, false);
+        plan->m_retry_without_dynamic_obstacles = false;
+        dj_solver_begin(&plan->m_solver, &plan->m_start_status);
+        return;
+    }
+
+    dj_solver_deinit(&plan->m_solver);
+    plan->m_stage = DJ_PLAN_STAGE_DONE;
+}
+
+/**
+ * @brief Function to abandon the query done by slices of a planner
+ *
+ * @param [in] planner The planner
+ */
+static void abandon_plan(dj_planner_t *planner)
+{
+    dj_plan_t *plan = &planner->m_plan;
+    if (plan->m_stage == DJ_PLAN_STAGE_SOLVE)
+    {
+        dj_solver_deinit(&plan->m_solver);
+    }
+    if (plan->m_stage != DJ_PLAN_STAGE_IDLE)
+    {
+        dj_graph_path_deinit(&plan->m_path);
+        viewer_status_deinit(&plan->m_start_status);
+    }
+    plan->m_stage = DJ_PLAN_STAGE_IDLE;
+}
+
+void dj_planner_config_init(dj_planner_config_t *config)
+{
+    dj_control_non_null(config, );
+    config->m_solver = dj_solver_get_vtable(DJ_SOLVER_TYPE);
+    config->m_enable_rebuild_optimization = DJ_ENABLE_REBUILD_OPTIMIZATION;
+    config->m_epsilon = DJ_SOLVER_ASTAR_EPSILON;
+    config->m_heuristic = NULL;
+}
+
+void dj_planner_init(dj_planner_t *planner)
+{
+    dj_control_non_null(planner, );
+    dj_graph_builder_init(&planner->m_builder);
+    dj_solver_common_init_workspace(&planner->m_workspace);
+    planner->m_plan.m_stage = DJ_PLAN_STAGE_IDLE;
+}
+
+void dj_planner_deinit(dj_planner_t *planner)
+{
+    dj_control_non_null(planner, );
+    abandon_plan(planner);
+    dj_graph_builder_deinit(&planner->m_builder);
+}
+
+bool dj_genarate_path_with_param(dj_planner_t *planner,
+                                 dj_graph_path_t *path,
+                                 GEOMETRY_point_t target_point,
+                                 bool enable_dynamic_obstacles,
+                                 const dj_planner_config_t *config)
+{
+    return generate_path(planner, path, target_point, enable_dynamic_obstacles, config, false, 0, NULL, false);
+}
+
+bool dj_genarate_path_with_budget(dj_planner_t *planner,
+                                  dj_graph_path_t *path,
+                                  GEOMETRY_point_t target_point,
+                                  bool enable_dynamic_obstacles,
+                                  uint32_t budget_us,
+                                  float *bound)
+{
+    return generate_path(planner, path, target_point, enable_dynamic_obstacles, NULL, true, budget_us, bound, false);
+}
+
+uint32_t dj_genarate_paths_to_targets(dj_planner_t *planner,
+                                      const GEOMETRY_point_t *target_points,
+                                      uint32_t nb_targets,
+                                      bool enable_dynamic_obstacles,
+                                      uint32_t budget_us,
+                                      time32_t *durations,
+                                      dj_graph_path_t *paths)
+{
+    dj_control_non_null(target_points, 0);
+    dj_control_non_null(durations, 0);
+    if (nb_targets == 0)
+    {
+        return 0;
+    }
+    planner = get_planner(planner);
+
+    // The budget includes the building of the graph
+    uint32_t deadline_us;
+    dj_dep_get_time_us(&deadline_us);
+    deadline_us += budget_us;
+
+    dj_mark_reset_all();
+    dj_mark_start_time(DJ_MARK_ALL);
+
+    dj_debug_printf("Start of dj with %d targets\n", (int)nb_targets);
+    GEOMETRY_point_t start_point;
+    dj_viewer_status_t viewer_status;
+    get_start_status(&viewer_status, &start_point);
+
+    // Fisrt rebuild the graph with the prebuilt graph. The end node is on the start point, no path goes back to it :
+    // all the targets are added the same way, after the nodes common to all of them.
+    dj_graph_builder_t *builder = get_first_rebuilt_builder(planner, start_point, start_point, enable_dynamic_obstacles);
+    for (uint32_t i = 0; i < MIN(nb_targets, DJ_SOLVER_MAX_TARGETS); i++)
+    {
+        dj_graph_builder_add_target(builder, target_points[i]);
+    }
+
+    // Solve the graph for all the targets at once (the dijkstra algorithm doesn't depend on the goal)
+    dj_solver_dijkstra_t solver;
+    dj_solver_dijkstra_init(&solver, builder, &planner->m_workspace);
+    uint32_t nb_reached_targets = dj_solver_dijkstra_solve_targets(
+        &solver, &viewer_status, target_points, nb_targets, budget_us != 0, deadline_us, durations, paths);
+
+    dj_solver_dijkstra_deinit(&solver);
+    viewer_status_deinit(&viewer_status);
+
+    dj_mark_end_time(DJ_MARK_ALL);
+    dj_print_all_durations();
+    dj_debug_printf("DJ : %d/%d targets reached\n", (int)nb_reached_targets, (int)nb_targets);
+
+    return nb_reached_targets;
+}
+
+uint32_t dj_genarate_alternative_paths(dj_planner_t *planner,
+                                       dj_graph_path_t *paths,
+                                       uint32_t max_paths,
+                                       GEOMETRY_point_t target_point,
+                                       bool enable_dynamic_obstacles)
+{
+    dj_control_non_null(paths, 0);
+    if (max_paths == 0)
+    {
+        return 0;
+    }
+    planner = get_planner(planner);
+
+    dj_mark_reset_all();
+    dj_mark_start_time(DJ_MARK_ALL);
+
+    dj_debug_printf("Start of dj (%d alternative paths) with these parameters:\n", (int)max_paths);
+    dj_debug_printf("Target point: (%d, %d)\n", target_point.x, target_point.y);
+    GEOMETRY_point_t start_point;
+    dj_viewer_status_t viewer_status;
+    get_start_status(&viewer_status, &start_point);
+
+    // Fisrt rebuild the graph with the prebuilt graph
+    dj_graph_builder_t *builder = get_first_rebuilt_builder(planner, start_point, target_point, enable_dynamic_obstacles);
+
+    // Keep the paths to the goal found by a single search
+    dj_solver_astar_t solver;
+    dj_solver_astar_init(&solver, builder, &planner->m_workspace);
+    uint32_t nb_paths = dj_solver_astar_solve_alternatives(&solver, &viewer_status, paths, max_paths);
+
+    dj_solver_astar_deinit(&solver);
+    viewer_status_deinit(&viewer_status);
+
+    dj_mark_end_time(DJ_MARK_ALL);
+    dj_print_all_durations();
+    dj_debug_printf("DJ : %d alternative paths found\n", (int)nb_paths);
+
+    return nb_paths;
+}
+
+bool dj_genarate_static_path(dj_planner_t *planner, dj_graph_path_t *path, GEOMETRY_point_t target_point)
+{
+    dj_control_non_null(path, false);
+    planner = get_planner(planner);
+
+    dj_mark_reset_all();
+    dj_mark_start_time(DJ_MARK_ALL);
+
+    dj_debug_printf("Start of dj (static path) with these parameters:\n");
+    dj_debug_printf("Target point: (%d, %d)\n", target_point.x, target_point.y);
+    GEOMETRY_point_t start_point;
+    dj_viewer_status_t viewer_status;
+    get_start_status(&viewer_status, &start_point);
+    dj_graph_path_init(path, &viewer_status);
+
+    // Link the start and the target to the prebuilt graph (only the static obstacles are taken into account)
+    dj_graph_builder_t *builder = get_first_rebuilt_builder(planner, start_point, target_point, false);
+
+    // Combine the shortest paths between the prebuilt nodes
+    bool result = get_static_path_with_prebuilt_table(builder, &planner->m_table_entries, path);
+
+    viewer_status_deinit(&viewer_status);
+
+    // Search the path if the table isn't available
+    if (!result)
+    {
+        dj_debug_printf("DJ : No static path found with the prebuilt table\n");
+        return dj_genarate_path_with_param(planner, path, target_point, false, NULL);
     }
+
+    dj_mark_end_time(DJ_MARK_ALL);
+    dj_print_all_durations();
+    return true;
+}
+
+bool dj_genarate_path(dj_planner_t *planner,
+                      dj_graph_path_t *path,
+                      GEOMETRY_point_t target_point,
+                      bool retry_without_dynamic_obstacle)
+{
+    // The retry without the dynamic obstacles reuses the graph of the first search
+    bool result = generate_path(planner, path, target_point, true, NULL, false, 0, NULL, retry_without_dynamic_obstacle);
     if (!result)
     {
         dj_info_printf("DJ : Path not found without dynamic obstacles, error unknown\n");
     }
     return result;
 }
+
+void dj_plan_begin(dj_planner_t *planner,
+                   GEOMETRY_point_t target_point,
+                   bool enable_dynamic_obstacles,
+                   bool retry_without_dynamic_obstacles,
+                   const dj_planner_config_t *config)
+{
+    planner = get_planner(planner);
+    abandon_plan(planner);
+    dj_plan_t *plan = &planner->m_plan;
+
+    // The configuration is copied, the query outlives the call
+    if (config == NULL)
+    {
+        dj_planner_config_init(&plan->m_config);
+    }
+    else
+    {
+        plan->m_config = *config;
+    }
+    plan->m_target_point = target_point;
+    plan->m_enable_dynamic_obstacles = enable_dynamic_obstacles;
+    plan->m_retry_without_dynamic_obstacles = retry_without_dynamic_obstacles;
+
+    dj_debug_printf("Start of dj (by slices) with these parameters:\n");
+    dj_debug_printf("Target point: (%d, %d)\n", target_point.x, target_point.y);
+    GEOMETRY_point_t start_point;
+    get_start_status(&plan->m_start_status, &start_point);
+    dj_graph_path_init(&plan->m_path, &plan->m_start_status);
+    plan->m_stage = DJ_PLAN_STAGE_BUILD;
+}
+
+dj_plan_status_e dj_plan_step(dj_planner_t *planner, uint32_t budget_us)
+{
+    planner = get_planner(planner);
+    dj_plan_t *plan = &planner->m_plan;
+
+    uint32_t deadline_us;
+    dj_dep_get_time_us(&deadline_us);
+    deadline_us += budget_us;
+
+    switch (plan->m_stage)
+    {
+    case DJ_PLAN_STAGE_BUILD:
+        // The building of the graph can't be split, the solve starts with the next slice
+        build_plan(planner);
+        return DJ_PLAN_STATUS_IN_PROGRESS;
+    case DJ_PLAN_STAGE_SOLVE:
+        if (dj_solver_step(&plan->m_solver, deadline_us))
+        {
+            end_plan_solve(planner);
+        }
+        return (plan->m_stage == DJ_PLAN_STAGE_DONE) ? DJ_PLAN_STATUS_DONE : DJ_PLAN_STATUS_IN_PROGRESS;
+    default:
+        return DJ_PLAN_STATUS_DONE;
+    }
+}
+
+bool dj_plan_result(dj_planner_t *planner, dj_graph_path_t *path)
+{
+    dj_control_non_null(path, false);
+    planner = get_planner(planner);
+    dj_plan_t *plan = &planner->m_plan;
+
+    if (plan->m_stage != DJ_PLAN_STAGE_DONE)
+    {
+        dj_debug_printf("DJ : The query isn't done\n");
+        return false;
+    }
+
+    dj_graph_path_copy(path, &plan->m_path);
+    abandon_plan(planner);
+
+    // Check if the path is valid (if the last point is the target point)
+    if (!is_path_to_target(path, plan->m_target_point))
+    {
+        dj_debug_printf("DJ : Impossible to find a path to the target point\n");
+        return false;
+    }
+    return true;
+}
@@ -12,38 +12,316 @@
 /* ******************************************************* Includes ****************************************************** */
 
 #include "../dj_graph/dj_graph_path.h"
+#include "../dj_graph_builder/dj_graph_builder.h"
+#include "../dj_graph_builder/dj_prebuilt_graph.h"
+#include "../dj_solver/dj_solver.h"
 
 /* ***************************************************** Public macros *************************************************** */
 
 /* ************************************************** Public types definition ******************************************** */
 
+/**
+ * @brief Strategy of the planner for a query
+ * @note It allows to compare or choose the strategies without rebuilding (see dj_planner_config_init)
+ */
+typedef struct
+{
+    /**
+     * @brief Solver to use (see dj_solver_get_vtable)
+     */
+    const dj_solver_vtable_t *m_solver;
+    /**
+     * @brief Enable the optimization of the rebuild (see DJ_ENABLE_REBUILD_OPTIMIZATION)
+     */
+    bool m_enable_rebuild_optimization;
+    /**
+     * @brief Tolerance of the path : its duration is at most (1 + epsilon) times the fastest one
+     *        (see DJ_SOLVER_ASTAR_EPSILON)
+     */
+    float m_epsilon;
+    /**
+     * @brief Heuristic of the A* solver (NULL for DJ_SOLVER_ASTAR_HEURISTIC, see dj_solver_heuristic.h)
+     * @note All the heuristics give the same duration with an epsilon of 0, only the number of expansions changes
+     */
+    dj_solver_heuristic_t m_heuristic;
+} dj_planner_config_t;
+
+/**
+ * @brief Status of a query done by slices (see dj_plan_step)
+ */
+typedef enum
+{
+    DJ_PLAN_STATUS_IN_PROGRESS,
+    DJ_PLAN_STATUS_DONE
+} dj_plan_status_e;
+
+/**
+ * @brief Stage of a query done by slices
+ */
+typedef enum
+{
+    DJ_PLAN_STAGE_IDLE,
+    DJ_PLAN_STAGE_BUILD,
+    DJ_PLAN_STAGE_SOLVE,
+    DJ_PLAN_STAGE_DONE
+} dj_plan_stage_e;
+
+/**
+ * @brief State of a query done by slices, kept between the slices (see dj_plan_begin)
+ */
+typedef struct
+{
+    /**
+     * @brief Stage of the query
+     */
+    dj_plan_stage_e m_stage;
+    /**
+     * @brief Strategy of the query
+     */
+    dj_planner_config_t m_config;
+    /**
+     * @brief Target point of the query
+     */
+    GEOMETRY_point_t m_target_point;
+    /**
+     * @brief Enable the dynamic obstacles
+     */
+    bool m_enable_dynamic_obstacles;
+    /**
+     * @brief Search again without the dynamic obstacles if no path is found (see dj_genarate_path)
+     */
+    bool m_retry_without_dynamic_obstacles;
+    /**
+     * @brief Status of the robot at the beginning of the query
+     */
+    dj_viewer_status_t m_start_status;
+    /**
+     * @brief Solver of the query
+     */
+    dj_solver_t m_solver;
+    /**
+     * @brief Path found by the query
+     */
+    dj_graph_path_t m_path;
+} dj_plan_t;
+
+/**
+ * @brief Planner : memory used by the queries
+ * @note The queries of different planners can run at the same time (e.g. one planner per thread). The obstacles and
+ *       the prebuilt graph are shared and only read by the queries : they musn't be imported, enabled or refreshed
+ *       while a query is running.
+ * @note The queries given a NULL planner use a default planner
+ */
+typedef struct
+{
+    /**
+     * @brief Graph builder, kept between the queries (see dj_graph_builder_first_rebuild)
+     */
+    dj_graph_builder_t m_builder;
+    /**
+     * @brief Memory of the solvers
+     */
+    dj_solver_workspace_t m_workspace;
+    /**
+     * @brief Memory of the static paths (see dj_genarate_static_path)
+     */
+    dj_prebuilt_table_entries_t m_table_entries;
+    /**
+     * @brief Query done by slices (see dj_plan_begin)
+     */
+    dj_plan_t m_plan;
+} dj_planner_t;
+
 /* *********************************************** Public functions declarations ***************************************** */
 
+/**
+ * @brief Function to initialize a planner configuration with the default values (DJ_SOLVER_TYPE,
+ *        DJ_ENABLE_REBUILD_OPTIMIZATION, DJ_SOLVER_ASTAR_EPSILON)
+ *
+ * @param [out] config The configuration to initialize
+ */
+void dj_planner_config_init(dj_planner_config_t *config);
+
+/**
+ * @brief Function to initialize a planner
+ * @note The planner is big, it shouldn't be on the stack of a small thread
+ *
+ * @param [out] planner The planner to initialize
+ */
+void dj_planner_init(dj_planner_t *planner);
+
+/**
+ * @brief Function to deinitialize a planner
+ *
+ * @param planner The planner to deinitialize
+ */
+void dj_planner_deinit(dj_planner_t *planner);
+
 /**
  * @brief Function to generate a path from the current position to the target point
  * @note If any path is possible to generate, this function will not disable the dynamic obstacles
  * @see dj_genarate_path
  *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
  * @param [out] path The path to generate
  * @param [in] target_point The target point
  * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ * @param [in] config Strategy of the planner (NULL for the default one, see dj_planner_config_init)
  *
  * @return true if on success, false otherwise
  */
-bool dj_genarate_path_with_param(dj_graph_path_t *path, GEOMETRY_point_t target_point, bool enable_dynamic_obstacles);
+bool dj_genarate_path_with_param(dj_planner_t *planner,
+                                 dj_graph_path_t *path,
+                                 GEOMETRY_point_t target_point,
+                                 bool enable_dynamic_obstacles,
+                                 const dj_planner_config_t *config);
+
+/**
+ * @brief Function to generate a path from the current position to the target point within a computing budget
+ * @note A first path is found quickly, then it is improved until the budget is spent (see
+ *       DJ_SOLVER_ANYTIME_INITIAL_WEIGHT). The best path found in time is returned.
+ * @note If no path is found in time, the shortest static path of the prebuilt table is returned (see
+ *       dj_genarate_static_path) : it only avoids the static obstacles and its bound is 0
+ * @see dj_genarate_path_with_param
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [out] path The path to generate
+ * @param [in] target_point The target point
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ * @param [in] budget_us Maximum duration of the generation (us), including the building of the graph
+ * @param [out] bound Bound of the ratio between the duration of the path and the fastest one, 1 if the path is
+ *                    the fastest one, 0 if it is the static path of the prebuilt table (can be NULL)
+ *
+ * @return true on success, false if no path has been found (neither in time nor in the prebuilt table)
+ */
+bool dj_genarate_path_with_budget(dj_planner_t *planner,
+                                  dj_graph_path_t *path,
+                                  GEOMETRY_point_t target_point,
+                                  bool enable_dynamic_obstacles,
+                                  uint32_t budget_us,
+                                  float *bound);
+
+/**
+ * @brief Function to compute the fastest paths from the current position to many target points
+ * @note A single search is done for all the targets, it is faster than one generation per target
+ *       (e.g. to choose the nearest target in time) and gives the same durations
+ * @see dj_genarate_path_with_param
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [in] target_points The target points
+ * @param [in] nb_targets Number of target points (only the first DJ_SOLVER_MAX_TARGETS ones are searched)
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ * @param [in] budget_us Maximum duration of the generation (us), including the building of the graph (0 for no limit)
+ * @param [out] durations Duration of the fastest path to each target (UINT32_MAX if the target isn't reached)
+ * @param [out] paths Fastest path to each target, must be deinitialized by the caller (can be NULL)
+ *
+ * @return uint32_t Number of targets reached
+ */
+uint32_t dj_genarate_paths_to_targets(dj_planner_t *planner,
+                                      const GEOMETRY_point_t *target_points,
+                                      uint32_t nb_targets,
+                                      bool enable_dynamic_obstacles,
+                                      uint32_t budget_us,
+                                      time32_t *durations,
+                                      dj_graph_path_t *paths);
+
+/**
+ * @brief Function to generate the fastest path and alternative paths from the current position to the target point
+ * @note The paths come from a single A* search (see dj_solver_astar_solve_alternatives). If the robot can't follow
+ *       the first path (e.g. an avoidance is triggered), the next one can be tried without planning again.
+ * @see dj_genarate_path_with_param
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [out] paths Paths from the fastest to the slowest, they are distinct from each other
+ *                    (see DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP)
+ * @param [in] max_paths Maximum number of paths
+ * @param [in] target_point The target point
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ *
+ * @return uint32_t Number of paths found (0 if the target can't be reached)
+ */
+uint32_t dj_genarate_alternative_paths(dj_planner_t *planner,
+                                       dj_graph_path_t *paths,
+                                       uint32_t max_paths,
+                                       GEOMETRY_point_t target_point,
+                                       bool enable_dynamic_obstacles);
+
+/**
+ * @brief Function to generate a path from the current position to the target point without the dynamic obstacles
+ * @note The path combines the precomputed shortest paths between the prebuilt nodes (see DJ_PREBUILT_TABLE_MODE),
+ *       so it is found in almost constant time. It is the shortest path and not the fastest one, it may be a bit
+ *       slower than the one of dj_genarate_path_with_param.
+ * @note If the table is disabled or outdated, the path is searched as usual (without the dynamic obstacles)
+ * @see dj_genarate_path_with_param
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [out] path The path to generate
+ * @param [in] target_point The target point
+ *
+ * @return true on success, false otherwise
+ */
+bool dj_genarate_static_path(dj_planner_t *planner, dj_graph_path_t *path, GEOMETRY_point_t target_point);
 
 /**
  * @brief Function to generate a path from the current position to the target point
  * @note If any path is possible to generate, the dynamic obstacles will be disabled and the path will be generated
  * @see dj_genarate_path_with_param
  *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
  * @param [out] path The path to generate
  * @param [in] target_point The target point
  * @param [in] retry_without_dynamic_obstacle If true, the robot will try to generate a path without dynamic obstacles
  *
  * @return true on success, false otherwise
  */
-bool dj_genarate_path(dj_graph_path_t *path, GEOMETRY_point_t target_point, bool retry_without_dynamic_obstacle);
+bool dj_genarate_path(dj_planner_t *planner,
+                      dj_graph_path_t *path,
+                      GEOMETRY_point_t target_point,
+                      bool retry_without_dynamic_obstacle);
+
+/**
+ * @brief Function to start a query done by slices, for a main loop which can't be blocked by the whole query
+ * @note The query is done by dj_plan_step, then its path is read by dj_plan_result. It gives the same path as
+ *       dj_genarate_path_with_param (and dj_genarate_path with the retry).
+ * @note The planner musn't be used by another query until the path is read. The obstacles musn't be imported,
+ *       enabled or refreshed between the slices.
+ * @note A query already started on the planner is abandoned
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [in] target_point The target point
+ * @param [in] enable_dynamic_obstacles Enable the dynamic obstacles
+ * @param [in] retry_without_dynamic_obstacles If true and no path is found, search again without the dynamic
+ *                                             obstacles (see dj_genarate_path)
+ * @param [in] config Strategy of the planner (NULL for the default one, see dj_planner_config_init)
+ */
+void dj_plan_begin(dj_planner_t *planner,
+                   GEOMETRY_point_t target_point,
+                   bool enable_dynamic_obstacles,
+                   bool retry_without_dynamic_obstacles,
+                   const dj_planner_config_t *config);
+
+/**
+ * @brief Function to go on with the query started by dj_plan_begin during a slice of time
+ * @note The first slice builds the graph, it can't be split and can last longer than the budget. The next slices
+ *       explore the graph until the budget is spent (at least one node per slice, so the query always progresses).
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [in] budget_us Duration of the slice (us)
+ *
+ * @return dj_plan_status_e DJ_PLAN_STATUS_DONE if the path can be read (or if no query is started),
+ *         DJ_PLAN_STATUS_IN_PROGRESS otherwise
+ */
+dj_plan_status_e dj_plan_step(dj_planner_t *planner, uint32_t budget_us);
+
+/**
+ * @brief Function to read the path of the query done by slices, it ends the query
+ *
+ * @param [in] planner The planner (NULL for the default planner, see dj_planner_t)
+ * @param [out] path The path found
+ *
+ * @return true on success, false if no path has been found or if the query isn't done
+ */
+bool dj_plan_result(dj_planner_t *planner, dj_graph_path_t *path);
 
 /* ******************************************* Public callback functions declarations ************************************ */
 
@@ -0,0 +1,391 @@
+/**
+ * @file dj_plan_cache.c
+ * @brief Cache of the paths to the probable next targets, precomputed during the idle time
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_plan_cache.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+// Needed by the pthread functions in C99
+#define _POSIX_C_SOURCE 200112L
+
+#include "dj_plan_cache.h"
+
+#if DJ_ENABLE_PLAN_CACHE
+
+#include "../dj_dependencies/dj_dependencies.h"
+#include "../dj_logs/dj_logs.h"
+#include "../dj_obstacle_importer/dj_obstacle_importer.h"
+#include "dj_launcher.h"
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+#include <pthread.h>
+#endif
+
+/* **************************************************** Private macros *************************************************** */
+
+/* ************************************************ Private type definition ********************************************** */
+
+/**
+ * @brief Precomputed path to a registered target
+ */
+typedef struct
+{
+    /**
+     * @brief Registered target
+     */
+    GEOMETRY_point_t m_target_point;
+    /**
+     * @brief True if the path has been computed
+     */
+    bool m_is_computed;
+    /**
+     * @brief True if the path reaches the target
+     */
+    bool m_is_found;
+    /**
+     * @brief Position of the robot at the beginning of the computation
+     */
+    GEOMETRY_point_t m_start_point;
+    /**
+     * @brief Speed of the robot at the beginning of the computation
+     */
+    GEOMETRY_vector_t m_start_speed;
+    /**
+     * @brief Epoch of the obstacles at the beginning of the computation (see dj_obstacle_importer_get_epoch)
+     */
+    uint32_t m_epoch;
+    /**
+     * @brief Time of the robot at the beginning of the computation (see dj_dep_get_time)
+     */
+    time32_t m_time;
+    /**
+     * @brief Path to the target
+     */
+    dj_graph_path_t m_path;
+} cache_entry_t;
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static void lock_entries(void);
+static void unlock_entries(void);
+static bool is_same_point(GEOMETRY_point_t a, GEOMETRY_point_t b);
+static bool is_up_to_date(const cache_entry_t *entry,
+                          GEOMETRY_point_t start_point,
+                          GEOMETRY_vector_t start_speed,
+                          uint32_t epoch,
+                          time32_t now);
+static bool is_active(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status);
+static bool has_active_dynamic_obstacle(dj_viewer_status_t *viewer_status);
+
+/* ************************************************** Private variables ************************************************** */
+
+/**
+ * @brief Planner of the precomputations
+ * @note It is global to avoid stack overflow
+ */
+static dj_planner_t cache_planner DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief True if the planner of the precomputations is initialized
+ */
+static bool cache_planner_initialized = false;
+
+/**
+ * @brief Precomputed paths
+ */
+static cache_entry_t entries[DJ_PLAN_CACHE_MAX_TARGETS] DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief Number of registered targets
+ */
+static uint8_t nb_entries = 0;
+
+/**
+ * @brief Computation in progress (the m_path field isn't used, the path is in the planner)
+ */
+static cache_entry_t planned_entry;
+
+/**
+ * @brief True while a path is being computed
+ */
+static bool is_planning = false;
+
+/**
+ * @brief Path computed by the last computation
+ * @note It is global to avoid stack overflow
+ */
+static dj_graph_path_t planned_path DJ_DEP_HEAP_VARS_SUFFIX;
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+/**
+ * @brief Mutex of the entries, the precomputations can be done by the thread of the planner service
+ */
+static pthread_mutex_t entries_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to lock the entries
+ */
+static void lock_entries(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&entries_mutex);
+#endif
+}
+
+/**
+ * @brief Function to unlock the entries
+ */
+static void unlock_entries(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_unlock(&entries_mutex);
+#endif
+}
+
+/**
+ * @brief Function to check if two points are the same
+ *
+ * @param a First point
+ * @param b Second point
+ * @return bool True if the points are the same
+ */
+static bool is_same_point(GEOMETRY_point_t a, GEOMETRY_point_t b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+/**
+ * @brief Function to check if a computed path can still be used
+ *
+ * @param entry The computed path
+ * @param start_point Current position of the robot
+ * @param start_speed Current speed of the robot
+ * @param epoch Current epoch of the obstacles
+ * @param now Current time of the robot (see dj_dep_get_time)
+ * @return bool True if the path is computed with the current obstacles from the current position and speed of the
+ *         robot
+ */
+static bool is_up_to_date(const cache_entry_t *entry,
+                          GEOMETRY_point_t start_point,
+                          GEOMETRY_vector_t start_speed,
+                          uint32_t epoch,
+                          time32_t now)
+{
+    // The speed changes the duration of the first segment and the rotation before it
+    int32_t speed_difference_x = start_speed.x - entry->m_start_speed.x;
+    int32_t speed_difference_y = start_speed.y - entry->m_start_speed.y;
+    return entry->m_is_computed && entry->m_epoch == epoch
+           && GEOMETRY_distance(entry->m_start_point, start_point) <= DJ_PLAN_CACHE_MAX_START_DISTANCE
+           && SQUARE(speed_difference_x) + SQUARE(speed_difference_y) <= SQUARE(DJ_PLAN_CACHE_MAX_START_SPEED_DIFFERENCE)
+           && now - entry->m_time <= DJ_PLAN_CACHE_MAX_AGE_MS;
+}
+
+/**
+ * @brief Function to check if a dynamic obstacle may meet the robot
+ *
+ * @param obstacle The dynamic obstacle (NULL if the obstacle is not available)
+ * @param viewer_status Current status of the robot
+ * @return bool True if the obstacle is enabled and may be reached by the robot before it expires
+ */
+static bool is_active(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status)
+{
+    return obstacle != NULL && obstacle->m_is_enabled && dj_obstacle_dynamic_may_be_reached(obstacle, viewer_status);
+}
+
+/**
+ * @brief Function to check if a dynamic obstacle may meet the robot along a precomputed path
+ * @note The dynamic obstacles move between the precomputation and the query even if they aren't refreshed, and the
+ *       path can't be checked again with the positions of the obstacles seen by the planner from the current status
+ *       of the robot without solving them again. So a path isn't used while a dynamic obstacle may meet the robot.
+ *
+ * @param viewer_status Current status of the robot
+ * @return bool True if an enabled dynamic obstacle may be reached by the robot before it expires
+ */
+static bool has_active_dynamic_obstacle(dj_viewer_status_t *viewer_status)
+{
+    for (dj_dynamic_obstacle_id_e obstacle_id = 0; obstacle_id < DYNAMIC_OBSTACLE_COUNT; obstacle_id++)
+    {
+        if (is_active(dj_obstacle_importer_get_dynamic_obstacle(obstacle_id), viewer_status))
+        {
+            return true;
+        }
+    }
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    uint16_t nb_pooled_obstacles = dj_obstacle_importer_get_pooled_dynamic_obstacle_count();
+    for (uint16_t i = 0; i < nb_pooled_obstacles; i++)
+    {
+        if (is_active(dj_obstacle_importer_get_pooled_dynamic_obstacle(i), viewer_status))
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+void dj_plan_cache_set_targets(const GEOMETRY_point_t *target_points, uint8_t nb_targets)
+{
+    if (target_points == NULL)
+    {
+        nb_targets = 0;
+    }
+    nb_targets = MIN(nb_targets, DJ_PLAN_CACHE_MAX_TARGETS);
+
+    lock_entries();
+    for (uint8_t i = 0; i < nb_targets; i++)
+    {
+        // The entry of a target already registered is moved to its new place
+        uint8_t j = i;
+        while (j < nb_entries && !is_same_point(entries[j].m_target_point, target_points[i]))
+        {
+            j++;
+        }
+        if (j < nb_entries)
+        {
+            cache_entry_t entry = entries[i];
+            entries[i] = entries[j];
+            entries[j] = entry;
+        }
+        else
+        {
+            entries[i].m_target_point = target_points[i];
+            entries[i].m_is_computed = false;
+        }
+    }
+    nb_entries = nb_targets;
+    unlock_entries();
+}
+
+bool dj_plan_cache_process(uint32_t budget_us)
+{
+    if (!cache_planner_initialized)
+    {
+        dj_planner_init(&cache_planner);
+        cache_planner_initialized = true;
+    }
+
+    GEOMETRY_point_t start_point;
+    dj_dep_get_robot_position(&start_point);
+    GEOMETRY_vector_t start_speed;
+    dj_dep_get_robot_speed(&start_speed);
+    uint32_t epoch = dj_obstacle_importer_get_epoch();
+    time32_t now;
+    dj_dep_get_time(&now);
+
+    // The computation in progress is abandoned if the obstacles have changed or if the robot has moved
+    if (is_planning && !is_up_to_date(&planned_entry, start_point, start_speed, epoch, now))
+    {
+        is_planning = false;
+    }
+
+    if (!is_planning)
+    {
+        // The first path which isn't up to date is computed
+        lock_entries();
+        uint8_t i = 0;
+        while (i < nb_entries && is_up_to_date(&entries[i], start_point, start_speed, epoch, now))
+        {
+            i++;
+        }
+        if (i == nb_entries)
+        {
+            unlock_entries();
+            return false;
+        }
+        planned_entry.m_target_point = entries[i].m_target_point;
+        unlock_entries();
+
+        planned_entry.m_is_computed = true;
+        planned_entry.m_start_point = start_point;
+        planned_entry.m_start_speed = start_speed;
+        planned_entry.m_epoch = epoch;
+        planned_entry.m_time = now;
+        dj_plan_begin(&cache_planner, planned_entry.m_target_point, true, false, NULL);
+        is_planning = true;
+    }
+
+    if (dj_plan_step(&cache_planner, budget_us) == DJ_PLAN_STATUS_DONE)
+    {
+        planned_entry.m_is_found = dj_plan_result(&cache_planner, &planned_path);
+        is_planning = false;
+
+        // The targets may have changed during the computation
+        lock_entries();
+        for (uint8_t i = 0; i < nb_entries; i++)
+        {
+            if (is_same_point(entries[i].m_target_point, planned_entry.m_target_point))
+            {
+                entries[i] = planned_entry;
+                dj_graph_path_copy(&entries[i].m_path, &planned_path);
+            }
+        }
+        unlock_entries();
+        dj_debug_printf("DJ : Path to (%d, %d) precomputed\n",
+                        planned_entry.m_target_point.x,
+                        planned_entry.m_target_point.y);
+    }
+    return true;
+}
+
+bool dj_plan_cache_get_path(GEOMETRY_point_t target_point, dj_graph_path_t *path)
+{
+    dj_control_non_null(path, false);
+
+    GEOMETRY_point_t start_point;
+    dj_dep_get_robot_position(&start_point);
+    GEOMETRY_vector_t start_speed;
+    dj_dep_get_robot_speed(&start_speed);
+    uint32_t epoch = dj_obstacle_importer_get_epoch();
+    time32_t now;
+    dj_dep_get_time(&now);
+
+    // The path starts from the current status of the robot, like a path computed now
+    // (the robot may have moved by DJ_PLAN_CACHE_MAX_START_DISTANCE since the precomputation)
+    dj_viewer_status_t init_status;
+    viewer_status_init(&init_status, &start_point, &start_speed, now);
+    if (has_active_dynamic_obstacle(&init_status))
+    {
+        dj_debug_printf("DJ : Cache not used, a dynamic obstacle may be met\n");
+        return false;
+    }
+
+    bool is_found = false;
+    lock_entries();
+    for (uint8_t i = 0; i < nb_entries; i++)
+    {
+        if (is_same_point(entries[i].m_target_point, target_point)
+            && is_up_to_date(&entries[i], start_point, start_speed, epoch, now) && entries[i].m_is_found)
+        {
+            dj_graph_path_init(path, &init_status);
+            for (uint32_t j = 1; j < dj_graph_path_get_point_count(&entries[i].m_path); j++)
+            {
+                GEOMETRY_point_t point;
+                dj_graph_path_get_point(&entries[i].m_path, &point, j);
+                dj_graph_path_add_point(path, &point);
+            }
+            dj_graph_path_set_as_finished(path, dj_graph_path_is_finished(&entries[i].m_path));
+            is_found = true;
+            break;
+        }
+    }
+    unlock_entries();
+
+    if (is_found)
+    {
+        dj_graph_path_get_duration(path);
+        dj_debug_printf("DJ : Path to (%d, %d) found in the cache\n", target_point.x, target_point.y);
+    }
+    return is_found;
+}
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file dj_plan_cache.h
+ * @brief Cache of the paths to the probable next targets, precomputed during the idle time
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_plan_cache.c
+ */
+
+#ifndef __DJ_PLAN_CACHE_H__
+#define __DJ_PLAN_CACHE_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../dj_config.h"
+#include "../dj_graph/dj_graph_path.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/* ************************************************** Public types definition ******************************************** */
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+#if DJ_ENABLE_PLAN_CACHE
+
+/**
+ * @brief Function to register the probable next targets, their paths are precomputed by dj_plan_cache_process
+ * @note The paths of the targets already registered are kept, the other ones are forgotten
+ *
+ * @param [in] target_points The probable next targets (NULL to forget all the targets)
+ * @param [in] nb_targets Number of targets (at most DJ_PLAN_CACHE_MAX_TARGETS, the next ones are ignored)
+ */
+void dj_plan_cache_set_targets(const GEOMETRY_point_t *target_points, uint8_t nb_targets);
+
+/**
+ * @brief Function to precompute the paths to the registered targets during a slice of idle time
+ * @note It must be called by the main loop when the robot doesn't move, or it is called by the planner service
+ *       when it has no target (see dj_planner_service.h). It musn't be called by two threads.
+ * @note A path is precomputed again when the obstacles change (see dj_obstacle_importer_get_epoch), when the robot
+ *       moves or changes its speed, or when it gets older than DJ_PLAN_CACHE_MAX_AGE_MS (time of the robot, see
+ *       dj_dep_get_time)
+ * @see dj_plan_step
+ *
+ * @param [in] budget_us Duration of the slice (us)
+ *
+ * @return true if a path is being precomputed, false if all the paths are up to date
+ */
+bool dj_plan_cache_process(uint32_t budget_us);
+
+/**
+ * @brief Function to get the precomputed path to a target
+ * @note It is used by the queries (see dj_genarate_path), the path is up to date with the current obstacles and the
+ *       current position and speed of the robot. It starts from the current status of the robot and is evaluated
+ *       again from the current time (see dj_dep_get_time).
+ * @note No path is returned while an enabled dynamic obstacle may meet the robot (see
+ *       dj_obstacle_dynamic_may_be_reached): the obstacles have moved since the precomputation.
+ *
+ * @param [in] target_point The target point
+ * @param [out] path The precomputed path
+ *
+ * @return true if an up to date path to the target has been found, false otherwise
+ */
+bool dj_plan_cache_get_path(GEOMETRY_point_t target_point, dj_graph_path_t *path);
+
+#endif
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
@@ -0,0 +1,486 @@
+/**
+ * @file dj_planner_service.c
+ * @brief Service which plans the path to the current target in the background
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_planner_service.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+// Needed by clock_gettime and the pthread functions in C99
+#define _POSIX_C_SOURCE 200112L
+
+#include "dj_planner_service.h"
+
+#if DJ_ENABLE_PLANNER_SERVICE
+
+#include "../dj_dependencies/dj_dependencies.h"
+#include "../dj_logs/dj_logs.h"
+#include "../dj_obstacle_importer/dj_obstacle_importer.h"
+#include "dj_launcher.h"
+#include "dj_plan_cache.h"
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/* **************************************************** Private macros *************************************************** */
+
+/**
+ * @brief Number of slots of the published paths : one written, one ready, one read
+ */
+#define NB_SLOTS 3
+
+/**
+ * @brief Flag of the ready slot if it hasn't been read yet
+ */
+#define SLOT_FRESH_FLAG 0x4
+
+/**
+ * @brief Mask of the index of the ready slot
+ */
+#define SLOT_INDEX_MASK 0x3
+
+/* ************************************************ Private type definition ********************************************** */
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static void init_slots(void);
+static dj_planner_service_result_t *get_written_slot(GEOMETRY_point_t target_point);
+static void publish_written_slot(bool is_found);
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+static void take_obstacles_snapshot(void);
+static void wait_period(void);
+static void *service_thread(void *arg);
+#endif
+
+/* ************************************************** Private variables ************************************************** */
+
+/**
+ * @brief Planner of the service
+ * @note It is global to avoid stack overflow
+ */
+static dj_planner_t service_planner DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief Published paths
+ * @note The slots are shared without lock : the planning writes the written slot, then swaps it with the ready slot.
+ *       The reader swaps the read slot with the ready slot if it is fresh. So each slot is used by one side only.
+ */
+static dj_planner_service_result_t slots[NB_SLOTS] DJ_DEP_HEAP_VARS_SUFFIX;
+
+/**
+ * @brief Index of the ready slot, with SLOT_FRESH_FLAG if it hasn't been read yet (only accessed atomically)
+ */
+static uint8_t ready_slot = 1;
+
+/**
+ * @brief Index of the slot written by the planning
+ */
+static uint8_t written_slot = 0;
+
+/**
+ * @brief Index of the slot read by the reader
+ */
+static uint8_t read_slot = 2;
+
+/**
+ * @brief Number of paths published
+ */
+static uint32_t nb_published = 0;
+
+/**
+ * @brief True if the service planner and the slots are initialized
+ */
+static bool is_initialized = false;
+
+/**
+ * @brief True while the service is running
+ */
+static bool is_running = false;
+
+/**
+ * @brief True if a target is set
+ */
+static bool has_target = false;
+
+/**
+ * @brief Current target
+ */
+static GEOMETRY_point_t target;
+
+/**
+ * @brief Retry without the dynamic obstacles for the current target
+ */
+static bool target_retry = false;
+
+/**
+ * @brief Number of the current target, incremented by each new target
+ */
+static uint32_t target_sequence = 0;
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+/**
+ * @brief Thread of the planning
+ */
+static pthread_t thread;
+
+/**
+ * @brief Mutex of the target and of the running flag
+ */
+static pthread_mutex_t state_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Condition signaled when the target or the running flag changes
+ */
+static pthread_cond_t state_cond = PTHREAD_COND_INITIALIZER;
+
+/**
+ * @brief Mutex of the obstacles, held during each copy of the obstacles (see dj_planner_service_lock)
+ */
+static pthread_mutex_t obstacles_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Snapshot of the obstacles read by the planning, so the obstacles can be modified during the planning
+ * @see dj_obstacle_importer_use_snapshot
+ */
+static dj_obstacle_importer_state_t obstacles_snapshot DJ_DEP_HEAP_VARS_SUFFIX;
+#else
+/**
+ * @brief True while a path is planned by slices
+ */
+static bool is_planning = false;
+
+/**
+ * @brief True if the obstacles have been modified during the planning by slices (see dj_planner_service_lock)
+ */
+static bool is_outdated = false;
+
+/**
+ * @brief Number of the target planned by slices
+ */
+static uint32_t planned_sequence = 0;
+
+/**
+ * @brief Time at which the last planning has started (see dj_dep_get_time_us)
+ */
+static uint32_t last_planning_us = 0;
+#endif
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to initialize the published paths
+ */
+static void init_slots(void)
+{
+    // The paths of the slots are initialized with invalid values
+    dj_viewer_status_t status;
+    viewer_status_init(&status, &(GEOMETRY_point_t){0, 0}, &(GEOMETRY_vector_t){0, 0}, 0);
+    for (uint8_t i = 0; i < NB_SLOTS; i++)
+    {
+        dj_graph_path_init(&slots[i].m_path, &status);
+        slots[i].m_sequence = 0;
+        slots[i].m_is_found = false;
+    }
+    viewer_status_deinit(&status);
+}
+
+/**
+ * @brief Function to get the slot written by the planning, for a new path
+ *
+ * @param [in] target_point Target point of the path
+ *
+ * @return dj_planner_service_result_t* The slot
+ */
+static dj_planner_service_result_t *get_written_slot(GEOMETRY_point_t target_point)
+{
+    dj_planner_service_result_t *slot = &slots[written_slot];
+    slot->m_target_point = target_point;
+    // The state of the robot and of the obstacles is read at the beginning of the planning
+    dj_dep_get_time_us(&slot->m_timestamp_us);
+    return slot;
+}
+
+/**
+ * @brief Function to publish the path of the written slot
+ *
+ * @param [in] is_found True if the path reaches the target
+ */
+static void publish_written_slot(bool is_found)
+{
+    dj_planner_service_result_t *slot = &slots[written_slot];
+    slot->m_is_found = is_found;
+    slot->m_sequence = ++nb_published;
+    // The written slot becomes the ready one, the previous ready slot is written next time
+    written_slot = __atomic_exchange_n(&ready_slot, written_slot | SLOT_FRESH_FLAG, __ATOMIC_ACQ_REL) & SLOT_INDEX_MASK;
+}
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+/**
+ * @brief Function to copy the obstacles modified since the previous planning in the snapshot of the planning
+ */
+static void take_obstacles_snapshot(void)
+{
+    pthread_mutex_lock(&obstacles_mutex);
+    dj_obstacle_importer_take_snapshot(&obstacles_snapshot);
+    pthread_mutex_unlock(&obstacles_mutex);
+}
+
+/**
+ * @brief Function to wait for DJ_PLANNER_SERVICE_PERIOD_US, or until the target or the running flag changes
+ * @pre The state mutex must be locked
+ */
+static void wait_period(void)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    uint64_t deadline_ns = (uint64_t)deadline.tv_nsec + (uint64_t)DJ_PLANNER_SERVICE_PERIOD_US * 1000;
+    deadline.tv_sec += (time_t)(deadline_ns / 1000000000);
+    deadline.tv_nsec = (long)(deadline_ns % 1000000000);
+    pthread_cond_timedwait(&state_cond, &state_mutex, &deadline);
+}
+
+/**
+ * @brief Function of the thread of the planning
+ *
+ * @param [in] arg Unused
+ *
+ * @return void* Unused
+ */
+static void *service_thread(void *arg)
+{
+    (void)arg;
+    // The planning reads the snapshot of the obstacles, without lock
+    dj_obstacle_importer_use_snapshot(&obstacles_snapshot);
+    pthread_mutex_lock(&state_mutex);
+    while (is_running)
+    {
+        if (!has_target)
+        {
+#if DJ_ENABLE_PLAN_CACHE
+            // The idle time is used to precompute the paths to the probable next targets
+            pthread_mutex_unlock(&state_mutex);
+            take_obstacles_snapshot();
+            bool is_idle = !dj_plan_cache_process(DJ_PLANNER_SERVICE_PERIOD_US);
+            pthread_mutex_lock(&state_mutex);
+            if (is_idle && is_running && !has_target)
+            {
+                wait_period();
+            }
+#else
+            pthread_cond_wait(&state_cond, &state_mutex);
+#endif
+            continue;
+        }
+        GEOMETRY_point_t target_point = target;
+        bool retry = target_retry;
+        uint32_t sequence = target_sequence;
+        pthread_mutex_unlock(&state_mutex);
+
+        take_obstacles_snapshot();
+        dj_planner_service_result_t *slot = get_written_slot(target_point);
+        bool is_found = dj_genarate_path(&service_planner, &slot->m_path, target_point, retry);
+        publish_written_slot(is_found);
+
+        // Wait for the next planning, a new target is planned at once
+        pthread_mutex_lock(&state_mutex);
+        if (is_running && sequence == target_sequence)
+        {
+            wait_period();
+        }
+    }
+    pthread_mutex_unlock(&state_mutex);
+    dj_obstacle_importer_use_snapshot(NULL);
+    return NULL;
+}
+#endif
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+bool dj_planner_service_start(void)
+{
+    if (is_running)
+    {
+        return true;
+    }
+    if (!is_initialized)
+    {
+        dj_planner_init(&service_planner);
+        init_slots();
+        is_initialized = true;
+    }
+
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    is_running = true;
+    if (pthread_create(&thread, NULL, service_thread, NULL) != 0)
+    {
+        is_running = false;
+        dj_error_printf("DJ : Impossible to create the thread of the planner service\n");
+        return false;
+    }
+#else
+    is_running = true;
+    is_planning = false;
+#endif
+    return true;
+}
+
+void dj_planner_service_stop(void)
+{
+    if (!is_running)
+    {
+        return;
+    }
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&state_mutex);
+    is_running = false;
+    pthread_cond_signal(&state_cond);
+    pthread_mutex_unlock(&state_mutex);
+    pthread_join(thread, NULL);
+#else
+    is_running = false;
+    is_planning = false;
+#endif
+}
+
+void dj_planner_service_set_target(GEOMETRY_point_t target_point, bool retry_without_dynamic_obstacle)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&state_mutex);
+#endif
+    target = target_point;
+    target_retry = retry_without_dynamic_obstacle;
+    has_target = true;
+    target_sequence++;
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_cond_signal(&state_cond);
+    pthread_mutex_unlock(&state_mutex);
+#endif
+}
+
+void dj_planner_service_clear_target(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&state_mutex);
+#endif
+    has_target = false;
+    target_sequence++;
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_unlock(&state_mutex);
+#endif
+}
+
+void dj_planner_service_process(uint32_t budget_us)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    (void)budget_us;
+#else
+    if (!is_running)
+    {
+        is_planning = false;
+        return;
+    }
+    if (!has_target)
+    {
+        is_planning = false;
+#if DJ_ENABLE_PLAN_CACHE
+        // The idle time is used to precompute the paths to the probable next targets
+        dj_plan_cache_process(budget_us);
+#endif
+        return;
+    }
+
+    uint32_t now_us;
+    dj_dep_get_time_us(&now_us);
+    if (!is_planning || planned_sequence != target_sequence)
+    {
+        // Wait for the next planning, a new target is planned at once
+        if (planned_sequence == target_sequence && !is_outdated
+            && now_us - last_planning_us < DJ_PLANNER_SERVICE_PERIOD_US)
+        {
+            return;
+        }
+        get_written_slot(target);
+        dj_plan_begin(&service_planner, target, true, target_retry, NULL);
+        is_planning = true;
+        is_outdated = false;
+        planned_sequence = target_sequence;
+        last_planning_us = now_us;
+    }
+
+    if (dj_plan_step(&service_planner, budget_us) == DJ_PLAN_STATUS_DONE)
+    {
+        bool is_found = dj_plan_result(&service_planner, &slots[written_slot].m_path);
+        publish_written_slot(is_found);
+        is_planning = false;
+    }
+#endif
+}
+
+bool dj_planner_service_get_result(dj_planner_service_result_t *result)
+{
+    dj_control_non_null(result, false);
+
+    // The target may be set by another thread
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&state_mutex);
+#endif
+    bool is_target_set = has_target;
+    GEOMETRY_point_t target_point = target;
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_unlock(&state_mutex);
+#endif
+
+    // The ready slot is taken only if it is fresh, otherwise the read slot is still the latest one
+    if (__atomic_load_n(&ready_slot, __ATOMIC_ACQUIRE) & SLOT_FRESH_FLAG)
+    {
+        read_slot = __atomic_exchange_n(&ready_slot, read_slot, __ATOMIC_ACQ_REL) & SLOT_INDEX_MASK;
+    }
+
+    dj_planner_service_result_t *slot = &slots[read_slot];
+    if (slot->m_sequence == 0 || !is_target_set || slot->m_target_point.x != target_point.x
+        || slot->m_target_point.y != target_point.y)
+    {
+        return false;
+    }
+
+    dj_graph_path_copy(&result->m_path, &slot->m_path);
+    result->m_target_point = slot->m_target_point;
+    result->m_timestamp_us = slot->m_timestamp_us;
+    result->m_sequence = slot->m_sequence;
+    result->m_is_found = slot->m_is_found;
+    return true;
+}
+
+uint32_t dj_planner_service_get_age_us(const dj_planner_service_result_t *result)
+{
+    dj_control_non_null(result, UINT32_MAX);
+    uint32_t now_us;
+    dj_dep_get_time_us(&now_us);
+    return now_us - result->m_timestamp_us;
+}
+
+void dj_planner_service_lock(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_lock(&obstacles_mutex);
+#else
+    // The path in progress is planned again with the new obstacles
+    is_outdated = is_planning;
+    is_planning = false;
+#endif
+}
+
+void dj_planner_service_unlock(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE_THREAD
+    pthread_mutex_unlock(&obstacles_mutex);
+#endif
+}
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
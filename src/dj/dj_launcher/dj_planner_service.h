@@ -0,0 +1,136 @@
+/**
+ * @file dj_planner_service.h
+ * @brief Service which plans the path to the current target in the background
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_planner_service.c
+ */
+
+#ifndef __DJ_PLANNER_SERVICE_H__
+#define __DJ_PLANNER_SERVICE_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../dj_config.h"
+#include "../dj_graph/dj_graph_path.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/* ************************************************** Public types definition ******************************************** */
+
+/**
+ * @brief Path published by the planner service
+ */
+typedef struct
+{
+    /**
+     * @brief Path from the position of the robot at m_timestamp_us to the target
+     */
+    dj_graph_path_t m_path;
+    /**
+     * @brief Target point of the path
+     */
+    GEOMETRY_point_t m_target_point;
+    /**
+     * @brief Time at which the state of the robot and of the obstacles has been read (see dj_dep_get_time_us)
+     */
+    uint32_t m_timestamp_us;
+    /**
+     * @brief Number of the path, each published path has a new one (0 : no path published)
+     */
+    uint32_t m_sequence;
+    /**
+     * @brief True if the path reaches the target
+     */
+    bool m_is_found;
+} dj_planner_service_result_t;
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+#if DJ_ENABLE_PLANNER_SERVICE
+
+/**
+ * @brief Function to start the planner service
+ * @note With DJ_ENABLE_PLANNER_SERVICE_THREAD, the paths are planned by a thread. Otherwise, they are planned by
+ *       slices in dj_planner_service_process.
+ * @note The service uses its own planner (see dj_planner_t), the other queries can still be done
+ *
+ * @return true on success, false if the thread can't be created
+ */
+bool dj_planner_service_start(void);
+
+/**
+ * @brief Function to stop the planner service (the path in progress is finished first)
+ */
+void dj_planner_service_stop(void);
+
+/**
+ * @brief Function to set the target of the planner service
+ * @note The path to the target is planned at once, then again every DJ_PLANNER_SERVICE_PERIOD_US from the latest
+ *       position of the robot and the latest obstacles
+ *
+ * @param [in] target_point The target point
+ * @param [in] retry_without_dynamic_obstacle If true, the path is searched again without the dynamic obstacles if
+ *                                            needed (see dj_genarate_path)
+ */
+void dj_planner_service_set_target(GEOMETRY_point_t target_point, bool retry_without_dynamic_obstacle);
+
+/**
+ * @brief Function to stop the planning until the next target
+ * @note Without target, the service precomputes the paths to the probable next targets (see dj_plan_cache.h)
+ */
+void dj_planner_service_clear_target(void);
+
+/**
+ * @brief Function to plan the paths during a slice of time, it must be called by the main loop
+ * @note It does nothing with DJ_ENABLE_PLANNER_SERVICE_THREAD
+ * @see dj_plan_step
+ *
+ * @param [in] budget_us Duration of the slice (us)
+ */
+void dj_planner_service_process(uint32_t budget_us);
+
+/**
+ * @brief Function to get the latest path published by the planner service, without waiting
+ * @note Only one thread may read the paths
+ *
+ * @param [out] result The latest path (see dj_planner_service_get_age_us)
+ *
+ * @return true if a path to the current target has been published, false otherwise
+ */
+bool dj_planner_service_get_result(dj_planner_service_result_t *result);
+
+/**
+ * @brief Function to get the age of a path published by the planner service
+ *
+ * @param [in] result The path
+ *
+ * @return uint32_t Duration since the state of the robot and of the obstacles has been read for the path (us)
+ */
+uint32_t dj_planner_service_get_age_us(const dj_planner_service_result_t *result);
+
+/**
+ * @brief Function to lock the obstacles before modifying them while the service is running
+ * @note The obstacles are only read by the planning. With DJ_ENABLE_PLANNER_SERVICE_THREAD, the planning reads a
+ *       snapshot of the obstacles taken before each path (see dj_obstacle_importer_take_snapshot), so the lock only
+ *       waits for the end of a copy. Otherwise, the path in progress is planned again.
+ * @warning The static obstacles must be imported before the start of the service (the prebuilt graph is computed
+ *          again by the import)
+ * @see dj_planner_service_unlock
+ */
+void dj_planner_service_lock(void);
+
+/**
+ * @brief Function to unlock the obstacles
+ * @see dj_planner_service_lock
+ */
+void dj_planner_service_unlock(void);
+
+#endif
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
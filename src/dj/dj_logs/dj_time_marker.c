@@ -32,10 +32,13 @@ typedef struct
  */
 const char *const dj_time_marker_names[] = {FOREACH(WORD_CONVERT_TO_STRING, DJ_MARKERS)};
 
+#if DJ_ENABLE_DEBUG_LOGS
 /**
  * @brief Array of time markers
+ * @note It is shared by all the planners, so it only exists with the debug logs (see dj_time_marker.h)
  */
 static dj_time_marker_t dj_time_markers[DJ_TIME_MARKER_TYPE_COUNT];
+#endif
 
 /* ********************************************** Private functions definitions ****************************************** */
 
@@ -43,8 +46,12 @@ static dj_time_marker_t dj_time_markers[DJ_TIME_MARKER_TYPE_COUNT];
 
 void dj_mark_reset(dj_time_marker_e type)
 {
+#if DJ_ENABLE_DEBUG_LOGS
     dj_time_markers[type].start_time = 0;
     dj_time_markers[type].duration = 0;
+#else
+    (void)type;
+#endif
 }
 
 void dj_mark_reset_all()
@@ -57,14 +64,22 @@ void dj_mark_reset_all()
 
 void dj_mark_start_time(dj_time_marker_e type)
 {
+#if DJ_ENABLE_DEBUG_LOGS
     dj_dep_get_time(&dj_time_markers[type].start_time);
+#else
+    (void)type;
+#endif
 }
 
 void dj_mark_end_time(dj_time_marker_e type)
 {
+#if DJ_ENABLE_DEBUG_LOGS
     time32_t end_time;
     dj_dep_get_time(&end_time);
     dj_time_markers[type].duration += end_time - dj_time_markers[type].start_time;
+#else
+    (void)type;
+#endif
 }
 
 void dj_print_duration(dj_time_marker_e type)
@@ -1,6 +1,8 @@
 /**
  * @file dj_time_marker.h
  * @brief Markers for dj can be used to measure the time taken by different parts of the code
+ * @note The markers are only measured with DJ_ENABLE_DEBUG_LOGS, they are shared by all the planners (see dj_planner_t)
+ *       so the durations are wrong if two planners run at the same time
  * @author Cyprien Ménard
  * @date 12/2024
  * @see dj_time_marker.c
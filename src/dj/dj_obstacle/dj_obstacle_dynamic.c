@@ -11,9 +11,11 @@
 #include "dj_obstacle_dynamic.h"
 #include "../dj_config.h"
 #include "../dj_dependencies/dj_dependencies.h"
+#include "../dj_graph/dj_graph_path.h"
 #include "../dj_logs/dj_logs.h"
 #include "../dj_prop_config/dj_prop_config.h"
 #include "dj_polygon.h"
+#include "dj_quartic.h"
 
 #include <math.h>
 #include <stdlib.h>
@@ -35,7 +37,7 @@
  */
 typedef struct
 {
-    GEOMETRY_point_t m_solutions[4];
+    GEOMETRY_point_t m_solutions[DJ_QUARTIC_MAX_ROOTS];
     uint8_t m_nb_solutions;
 } dj_dynamic_point_solution_t;
 
@@ -44,12 +46,12 @@ typedef struct
 static bool check_solution_validity(GEOMETRY_point_t *solution,
                                     dj_viewer_status_t *viewer_status,
                                     bool rotate_from_nul_speed);
-static void dj_point_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
-                                          dj_viewer_status_t *viewer_status,
-                                          dj_dynamic_point_solution_t *solution);
-static void point_to_polygon_solution(dj_obstacle_dynamic_t *obstacle,
-                                      GEOMETRY_point_t *point_solution,
-                                      dj_polygon_t *polygon_solution);
+static uint16_t get_shape_radius(dj_polygon_t *shape);
+static void get_quartic(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status, dj_quartic_t *quartic);
+static void roots_to_point_solution(dj_obstacle_dynamic_t *obstacle,
+                                    dj_quartic_roots_t *roots,
+                                    dj_dynamic_point_solution_t *solution);
+static bool is_immobile(dj_obstacle_dynamic_t *obstacle);
 
 /* ************************************************** Private variables ************************************************** */
 
@@ -104,16 +106,33 @@ static bool check_solution_validity(GEOMETRY_point_t *solution,
 }
 
 /**
- * @brief Function to get the position of the middle point of an dynamic obstacle in space time
+ * @brief Function to get the radius of the smallest circle centered on the origin containing a shape
+ *
+ * @param shape Shape of the obstacle
+ * @return uint16_t Radius of the circle (mm)
+ */
+static uint16_t get_shape_radius(dj_polygon_t *shape)
+{
+    dj_control_non_null(shape, 0);
+    uint32_t max_square_radius = 0;
+    for (uint16_t i = 0; i < shape->nb_points; i++)
+    {
+        uint32_t square_radius = SQUARE((int32_t)shape->points[i].x) + SQUARE((int32_t)shape->points[i].y);
+        max_square_radius = MAX(max_square_radius, square_radius);
+    }
+    return (uint16_t)ceilf(sqrtf((float)max_square_radius));
+}
+
+/**
+ * @brief Function to get the polynomial whose roots are the times where the viewer can meet the middle point
+ * of a dynamic obstacle
+ * @see dj_quartic_find_roots
  *
  * @param [in] obstacle dynamic obstacle to get the position
  * @param [in] viewer_status Status of the viewer
- * @param [out] solution Position of the middle of the obstacle
- * @return dj_dynamic_point_solution_t Position(s) of the obstacle (0 - 4 solutions)
+ * @param [out] quartic Polynomial to solve (its interval is empty if the obstacle is expired)
  */
-static void dj_point_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
-                                          dj_viewer_status_t *viewer_status,
-                                          dj_dynamic_point_solution_t *solution)
+static void get_quartic(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status, dj_quartic_t *quartic)
 {
     /*
         Explication des maths qui vont suivre
@@ -194,16 +213,11 @@ static void dj_point_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
         Et voilà, on a trouvé aucune/la/les position(s) de l'obstacle dans l'espace temps :)
     */
 
-    float start_time = viewer_status->m_time * 0.001f;
-    float end_time = (obstacle->m_update_time + OBSTACLE_LIFETIME_MS) * 0.001f;
     // Si end_time est inférieur à start_time, alors on a dépassé le temps max
-    // Il est inutile de continuer, l'obstacle est périmé
+    // Il n'y aura aucune solution, l'obstacle est périmé
     // En effet il est inconcevable de prédire la position d'un obstacle autant dans le futur
-    if (end_time < start_time)
-    {
-        solution->m_nb_solutions = 0;
-        return;
-    }
+    quartic->m_start_time = viewer_status->m_time * 0.001f;
+    quartic->m_end_time = (obstacle->m_update_time + OBSTACLE_LIFETIME_MS) * 0.001f;
 
     // Conversion des variables en unités SI (s, m, m/s, m/s²)
 
@@ -211,7 +225,6 @@ static void dj_point_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
     float trob = viewer_status->m_time * 0.001f;
 
     float Aadvx = obstacle->m_acceleration.x * 0.001f;
-    float Aadvy = obstacle->m_acceleration.y * 0.001f;
     float Vadviy = obstacle->m_initial_speed.y * 0.001f;
     float Vadvix = obstacle->m_initial_speed.x * 0.001f;
     float Padviy = obstacle->m_initial_position.y * 0.001f;
@@ -234,54 +247,56 @@ static void dj_point_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
     float l_e = (SQUARE(Aadvx * tadvi) / 2 - Vadvix * tadvi + Padvix - Probix)
                 + (SQUARE(Aadvx * tadvi) / 2 - Vadviy * tadvi + Padviy - Probiy) - SQUARE(Vrobi * trob - Arob * trob);
 
-    solution->m_nb_solutions = 0;
-    // start_sign = true si le signe de l'équation est positif
-    // On commence à t = 0, donc le signe dépend uniquement de e
-    bool sign = (l_e > 0) ? true : false;
-    for (float t = start_time; t < end_time; t += BRUTE_FORCE_STEP)
-    {
-        bool new_sign = (l_a * t * t * t * t + l_b * t * t * t + l_c * t * t + l_d * t + l_e > 0) ? true : false;
-        if (new_sign != sign)
-        {
-            // On a trouvé une solution
-            sign = new_sign;
-            // Calcul de la position de l'obstacle à ce temps
-            // (On prend soin de re-convertir les unités en mm)
-            solution->m_solutions[solution->m_nb_solutions]
-                = (GEOMETRY_point_t){.x = (Padvix + Vadvix * t + Aadvx * SQUARE(t) / 2) * 1000,
-                                     .y = (Padviy + Vadviy * t + Aadvy * SQUARE(t) / 2) * 1000};
-            if (solution->m_nb_solutions >= 3)
-            {
-                // On a trouvé toutes les solutions
-                break;
-            }
-            solution->m_nb_solutions++;
-        }
-    }
+    quartic->m_a = l_a;
+    quartic->m_b = l_b;
+    quartic->m_c = l_c;
+    quartic->m_d = l_d;
+    quartic->m_e = l_e;
 }
 
 /**
- * @brief Function to get the position of an artificial static obstacle from his shape and his position
+ * @brief Function to get the positions of the middle point of a dynamic obstacle at the roots of its polynomial
+ * @see get_quartic
  *
- * @param [in] obstacle Pointer on initial dynamic obstacle
- * @param [in] point_solution Solution of artificial static obstacle (as a point)
- * @param [out] polygon_solution Solution of artificial static obstacle (as a polygon)
+ * @param [in] obstacle dynamic obstacle
+ * @param [in] roots Roots of the polynomial of the obstacle
+ * @param [out] solution Position(s) of the middle of the obstacle (0 - 4 solutions)
  */
-static void point_to_polygon_solution(dj_obstacle_dynamic_t *obstacle,
-                                      GEOMETRY_point_t *point_solution,
-                                      dj_polygon_t *polygon_solution)
+static void roots_to_point_solution(dj_obstacle_dynamic_t *obstacle,
+                                    dj_quartic_roots_t *roots,
+                                    dj_dynamic_point_solution_t *solution)
 {
-    dj_control_non_null(obstacle, );
-    dj_control_non_null(point_solution, );
-    dj_control_non_null(polygon_solution, );
-    polygon_solution->nb_points = obstacle->m_initial_shape.nb_points;
-    for (uint8_t i = 0; i < obstacle->m_initial_shape.nb_points; i++)
+    // Conversion des variables en unités SI (s, m, m/s, m/s²)
+    float Aadvx = obstacle->m_acceleration.x * 0.001f;
+    float Aadvy = obstacle->m_acceleration.y * 0.001f;
+    float Vadviy = obstacle->m_initial_speed.y * 0.001f;
+    float Vadvix = obstacle->m_initial_speed.x * 0.001f;
+    float Padviy = obstacle->m_initial_position.y * 0.001f;
+    float Padvix = obstacle->m_initial_position.x * 0.001f;
+
+    solution->m_nb_solutions = roots->m_nb_roots;
+    for (uint8_t i = 0; i < roots->m_nb_roots; i++)
     {
-        polygon_solution->points[i] = (GEOMETRY_point_t){.x = point_solution->x + obstacle->m_initial_shape.points[i].x,
-                                                         .y = point_solution->y + obstacle->m_initial_shape.points[i].y};
+        float t = roots->m_roots[i];
+        // Calcul de la position de l'obstacle à ce temps
+        // (On prend soin de re-convertir les unités en mm)
+        solution->m_solutions[i] = (GEOMETRY_point_t){.x = (Padvix + Vadvix * t + Aadvx * SQUARE(t) / 2) * 1000,
+                                                      .y = (Padviy + Vadviy * t + Aadvy * SQUARE(t) / 2) * 1000};
     }
 }
 
+/**
+ * @brief Function to know if a dynamic obstacle has no speed and no acceleration
+ *
+ * @param obstacle dynamic obstacle
+ * @return true if the obstacle does not move, false otherwise
+ */
+static bool is_immobile(dj_obstacle_dynamic_t *obstacle)
+{
+    return obstacle->m_initial_speed.x == 0 && obstacle->m_initial_speed.y == 0 && obstacle->m_acceleration.x == 0
+           && obstacle->m_acceleration.y == 0;
+}
+
 /* *********************************************** Public functions declarations ***************************************** */
 
 void dj_obstacle_dynamic_init(dj_obstacle_dynamic_t *obstacle,
@@ -309,6 +324,7 @@ void dj_obstacle_dynamic_init(dj_obstacle_dynamic_t *obstacle,
     {
         obstacle->m_initial_shape.points[i] = *dj_polygon_get_point(initial_shape, i);
     }
+    obstacle->m_shape_radius = get_shape_radius(&obstacle->m_initial_shape);
 }
 
 void dj_obstacle_dynamic_deinit(dj_obstacle_dynamic_t *obstacle)
@@ -338,49 +354,264 @@ void dj_obstacle_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
                                       dj_dynamic_polygon_solution_t *solution)
 {
     dj_control_non_null(obstacle, );
+    dj_obstacle_dynamic_get_positions(&obstacle, 1, viewer_status, solution);
+}
+
+void dj_obstacle_dynamic_get_positions(dj_obstacle_dynamic_t **obstacles,
+                                       uint16_t nb_obstacles,
+                                       dj_viewer_status_t *viewer_status,
+                                       dj_dynamic_polygon_solution_t *solutions)
+{
+    dj_control_non_null(obstacles, );
     dj_control_non_null(viewer_status, );
-    dj_control_non_null(solution, );
+    dj_control_non_null(solutions, );
 
-    // Si la vitesse et l'accélération sont nulles alors la et l'unique solution est la position initiale du polygone.
-    // C'est plus un workaround qu'autre chose car les maths qui sont sensées faire ça ne semble pas fonctionner correctement.
-    // C'est pas très grave car à ce jour (12/05/2025), les obstacles dynamiques n'ont pas de vitesse ni d'accélération.
-    if (obstacle->m_initial_speed.x == 0 && obstacle->m_initial_speed.y == 0 && obstacle->m_acceleration.x == 0
-        && obstacle->m_acceleration.y == 0)
+    if (nb_obstacles > DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE)
     {
-        point_to_polygon_solution(obstacle, &obstacle->m_initial_position, &solution->m_solutions[0]);
-        solution->m_nb_solutions = 1;
-        return;
+        dj_error_printf("Too many dynamic obstacles in the batch\n");
+        nb_obstacles = DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE;
     }
 
-    // On commence par chercher les solutions avec une vitesse nulle puis avec la vitesse du viewer
-    dj_dynamic_point_solution_t found_points_from_nul_speed;
-    dj_point_dynamic_get_position(obstacle, viewer_status, &found_points_from_nul_speed);
-    dj_dynamic_point_solution_t found_points_from_viewer_speed;
-    dj_point_dynamic_get_position(obstacle, viewer_status, &found_points_from_viewer_speed);
+    // Polynômes de tous les obstacles mobiles, résolus en une seule fois
+    dj_quartic_t quartics[DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE];
+    dj_quartic_roots_t roots[DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE];
+    uint16_t quartic_obstacle_indexes[DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE];
+    uint16_t nb_quartics = 0;
 
-    // On va maintenant filtrer les solutions pour ne garder que celles qui sont valides
-    // Pour les solutions avec une vitesse nulle
-    solution->m_nb_solutions = 0;
-    for (uint8_t i = 0; i < found_points_from_nul_speed.m_nb_solutions; i++)
+    for (uint16_t i = 0; i < nb_obstacles; i++)
     {
-        if (check_solution_validity(&found_points_from_nul_speed.m_solutions[i], viewer_status, true))
+        dj_obstacle_dynamic_t *obstacle = obstacles[i];
+        dj_control_non_null(obstacle, );
+        // Les solutions sont toutes la forme initiale translatée, on ne garde donc qu'une référence vers la forme
+        solutions[i].m_shape = &obstacle->m_initial_shape;
+        solutions[i].m_nb_solutions = 0;
+
+        // Si la vitesse et l'accélération sont nulles alors la et l'unique solution est la position initiale du polygone.
+        // C'est plus un workaround qu'autre chose car les maths qui sont sensées faire ça ne semble pas fonctionner correctement.
+        // C'est pas très grave car à ce jour (12/05/2025), les obstacles dynamiques n'ont pas de vitesse ni d'accélération.
+        if (is_immobile(obstacle))
         {
-            point_to_polygon_solution(
-                obstacle, &found_points_from_nul_speed.m_solutions[i], &solution->m_solutions[solution->m_nb_solutions]);
-            solution->m_nb_solutions++;
+            solutions[i].m_offsets[0] = obstacle->m_initial_position;
+            solutions[i].m_nb_solutions = 1;
+            continue;
         }
+        get_quartic(obstacle, viewer_status, &quartics[nb_quartics]);
+        quartic_obstacle_indexes[nb_quartics] = i;
+        nb_quartics++;
     }
-    for (uint8_t i = 0; i < found_points_from_viewer_speed.m_nb_solutions; i++)
+
+    dj_quartic_find_roots(quartics, roots, nb_quartics, BRUTE_FORCE_STEP);
+
+    for (uint16_t quartic_index = 0; quartic_index < nb_quartics; quartic_index++)
     {
-        if (check_solution_validity(&found_points_from_viewer_speed.m_solutions[i], viewer_status, false))
+        uint16_t i = quartic_obstacle_indexes[quartic_index];
+        dj_dynamic_polygon_solution_t *solution = &solutions[i];
+        dj_dynamic_point_solution_t found_points;
+        roots_to_point_solution(obstacles[i], &roots[quartic_index], &found_points);
+
+        // On va maintenant filtrer les solutions pour ne garder que celles qui sont valides
+        // D'abord celles atteintes en partant d'une vitesse nulle puis celles atteintes avec la vitesse du viewer
+        for (uint8_t j = 0; j < found_points.m_nb_solutions; j++)
         {
-            point_to_polygon_solution(
-                obstacle, &found_points_from_viewer_speed.m_solutions[i], &solution->m_solutions[solution->m_nb_solutions]);
-            solution->m_nb_solutions++;
+            if (check_solution_validity(&found_points.m_solutions[j], viewer_status, true))
+            {
+                solution->m_offsets[solution->m_nb_solutions++] = found_points.m_solutions[j];
+            }
+        }
+        for (uint8_t j = 0; j < found_points.m_nb_solutions; j++)
+        {
+            if (check_solution_validity(&found_points.m_solutions[j], viewer_status, false))
+            {
+                solution->m_offsets[solution->m_nb_solutions++] = found_points.m_solutions[j];
+            }
         }
     }
 }
 
+bool dj_obstacle_dynamic_may_be_reached(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status)
+{
+    dj_control_non_null(obstacle, false);
+    dj_control_non_null(viewer_status, false);
+
+    // L'obstacle est périmé, il ne peut plus être atteint
+    time32_t end_time = obstacle->m_update_time + OBSTACLE_LIFETIME_MS;
+    if (end_time < viewer_status->m_time)
+    {
+        return false;
+    }
+
+    // Disque contenant toutes les positions de l'obstacle entre sa mise à jour et sa péremption
+    // (Unités : mm, s)
+    float obstacle_horizon = (end_time - obstacle->m_update_time) * 0.001f;
+    float obstacle_speed = sqrtf(SQUARE((float)obstacle->m_initial_speed.x) + SQUARE((float)obstacle->m_initial_speed.y));
+    float obstacle_acceleration
+        = sqrtf(SQUARE((float)obstacle->m_acceleration.x) + SQUARE((float)obstacle->m_acceleration.y));
+    float obstacle_radius = obstacle_speed * obstacle_horizon
+                            + obstacle_acceleration * SQUARE(obstacle_horizon) / 2 + obstacle->m_shape_radius;
+    float obstacle_x = obstacle->m_initial_position.x;
+    float obstacle_y = obstacle->m_initial_position.y;
+
+    // Si ce disque est entièrement en dehors du terrain, l'obstacle ne peut pas être rencontré
+    if (obstacle_x + obstacle_radius < 0 || obstacle_x - obstacle_radius > DJ_PLAYGROUND_X_SIZE
+        || obstacle_y + obstacle_radius < 0 || obstacle_y - obstacle_radius > DJ_PLAYGROUND_Y_SIZE)
+    {
+        return false;
+    }
+
+    // Disque contenant toutes les positions atteignables par le viewer sur le même horizon
+    // (Le viewer ne peut pas sortir du terrain, le rayon est donc limité à la diagonale du terrain)
+    float viewer_horizon = (end_time - viewer_status->m_time) * 0.001f;
+    float viewer_speed = sqrtf(SQUARE((float)viewer_status->m_speed.x) + SQUARE((float)viewer_status->m_speed.y));
+    float viewer_radius = viewer_speed * viewer_horizon + PROP_LINEAR_ACCELERATION * SQUARE(viewer_horizon) / 2;
+    viewer_radius = MIN(viewer_radius,
+                        sqrtf((float)(SQUARE((int32_t)DJ_PLAYGROUND_X_SIZE) + SQUARE((int32_t)DJ_PLAYGROUND_Y_SIZE))));
+
+    // Les deux disques doivent se chevaucher pour que l'obstacle puisse être rencontré
+    float square_distance
+        = SQUARE(obstacle_x - viewer_status->m_position.x) + SQUARE(obstacle_y - viewer_status->m_position.y);
+    return square_distance <= SQUARE(obstacle_radius + viewer_radius);
+}
+
+bool dj_obstacle_dynamic_is_segment_blocked(dj_obstacle_dynamic_t *obstacle,
+                                            dj_viewer_status_t *viewer_status,
+                                            GEOMETRY_point_t *target)
+{
+    dj_control_non_null(obstacle, false);
+    dj_control_non_null(viewer_status, false);
+    dj_control_non_null(target, false);
+
+    // Unités : mm, mm/s, mm/s², s
+    float aa = PROP_LINEAR_ACCELERATION;
+    float ad = PROP_LINEAR_DECELERATION;
+    float dx = target->x - viewer_status->m_position.x;
+    float dy = target->y - viewer_status->m_position.y;
+    float distance = sqrtf(SQUARE(dx) + SQUARE(dy));
+    if (distance > 0)
+    {
+        dx /= distance;
+        dy /= distance;
+    }
+
+    /*
+        Profil du viewer sur le segment :
+        si sa vitesse n'est pas dans la direction du segment, il freine et tourne sur place pendant start_delay,
+        puis il accélère depuis v0 jusqu'à t1 et freine jusqu'à l'arrêt sur la cible à T,
+        la durée T étant celle de l'évaluation des chemins (voir dj_graph_segment_get_duration)
+            v0 + aa * t1 = ad * (T - t1)
+        <=> t1 = (ad * T - v0) / (aa + ad)
+        Les distances de ce profil sont mises à l'échelle pour atteindre la cible à T
+    */
+    int16_t initial_speed = sqrtf(SQUARE((float)viewer_status->m_speed.x) + SQUARE((float)viewer_status->m_speed.y));
+    float start_delay = 0;
+    if (initial_speed != 0)
+    {
+        int16_t speed_angle = GEOMETRY_viewing_angle(0, 0, viewer_status->m_speed.x, viewer_status->m_speed.y);
+        int16_t target_angle = GEOMETRY_viewing_angle(
+            viewer_status->m_position.x, viewer_status->m_position.y, target->x, target->y);
+        int16_t angle_diff = GEOMETRY_modulo_angle(target_angle - speed_angle);
+        if (is_pre_rotation_needed(angle_diff))
+        {
+            start_delay = (1000 * initial_speed / PROP_LINEAR_DECELERATION + dj_graph_rotation_get_duration(angle_diff))
+                          * 0.001f;
+            initial_speed = 0;
+        }
+    }
+    GEOMETRY_segment_t segment = {viewer_status->m_position, *target};
+    float traversal_time = dj_graph_segment_get_duration(&segment, initial_speed, true) * 0.001f;
+    float v0 = initial_speed;
+    float t1 = MIN(MAX((ad * traversal_time - v0) / (aa + ad), 0.0f), traversal_time);
+    float v1 = v0 + aa * t1;
+    float s1 = v0 * t1 + aa * SQUARE(t1) / 2;
+    float profile_distance = s1 + v1 * (traversal_time - t1) - ad * SQUARE(traversal_time - t1) / 2;
+    float scale = (profile_distance > 0) ? distance / profile_distance : 0.0f;
+    float total_time = start_delay + traversal_time;
+
+    float viewer_time = viewer_status->m_time * 0.001f;
+    float update_time = obstacle->m_update_time * 0.001f;
+    float end_of_life_time = (obstacle->m_update_time + OBSTACLE_LIFETIME_MS) * 0.001f;
+    float step = DJ_CONTINUOUS_VALIDATION_STEP_MS * 0.001f;
+    float obstacle_speed = sqrtf(SQUARE((float)obstacle->m_initial_speed.x) + SQUARE((float)obstacle->m_initial_speed.y));
+    float obstacle_acceleration
+        = sqrtf(SQUARE((float)obstacle->m_acceleration.x) + SQUARE((float)obstacle->m_acceleration.y));
+    GEOMETRY_point_t out_point = (GEOMETRY_point_t){-10000, -10000};
+
+    // Le viewer peut partir de l'obstacle : seuls les premiers échantillons en contact sont ignorés
+    bool is_leaving_obstacle = true;
+    for (float t = 0; t <= total_time + step; t += step)
+    {
+        float time = MIN(t, total_time);
+        if (viewer_time + time > end_of_life_time)
+        {
+            // L'obstacle est périmé, il n'a plus de position
+            break;
+        }
+
+        // Position et vitesse du viewer sur le segment
+        float segment_time = MAX(time - start_delay, 0.0f);
+        float travelled_distance;
+        float viewer_speed;
+        if (time < start_delay)
+        {
+            // Freinage et rotation sur place
+            travelled_distance = 0;
+            viewer_speed = 0;
+        }
+        else if (segment_time <= t1)
+        {
+            travelled_distance = (v0 * segment_time + aa * SQUARE(segment_time) / 2) * scale;
+            viewer_speed = (v0 + aa * segment_time) * scale;
+        }
+        else
+        {
+            travelled_distance = (s1 + v1 * (segment_time - t1) - ad * SQUARE(segment_time - t1) / 2) * scale;
+            viewer_speed = (v1 - ad * (segment_time - t1)) * scale;
+        }
+        travelled_distance = MIN(travelled_distance, distance);
+        float viewer_x = viewer_status->m_position.x + dx * travelled_distance;
+        float viewer_y = viewer_status->m_position.y + dy * travelled_distance;
+
+        // Position de l'obstacle au même instant
+        float obstacle_time = viewer_time + time - update_time;
+        float obstacle_x = obstacle->m_initial_position.x + obstacle->m_initial_speed.x * obstacle_time
+                           + obstacle->m_acceleration.x * SQUARE(obstacle_time) / 2;
+        float obstacle_y = obstacle->m_initial_position.y + obstacle->m_initial_speed.y * obstacle_time
+                           + obstacle->m_acceleration.y * SQUARE(obstacle_time) / 2;
+
+        // Séparation avec le cercle englobant de l'obstacle (rejet rapide)
+        // Entre deux échantillons, la séparation ne peut pas diminuer de plus que ce que les deux parcourent en un demi pas
+        float separation = sqrtf(SQUARE(viewer_x - obstacle_x) + SQUARE(viewer_y - obstacle_y)) - obstacle->m_shape_radius;
+        float tolerance = (viewer_speed + obstacle_speed + obstacle_acceleration * obstacle_time) * step / 2;
+        if (separation > tolerance)
+        {
+            is_leaving_obstacle = false;
+            continue;
+        }
+
+        // Test précis dans le repère de l'obstacle :
+        // le viewer est dans la forme ou à une distance de la forme plus petite que la tolérance
+        GEOMETRY_point_t local_viewer
+            = (GEOMETRY_point_t){.x = (int16_t)(viewer_x - obstacle_x), .y = (int16_t)(viewer_y - obstacle_y)};
+        GEOMETRY_polygon_t local_shape;
+        dj_polygon_to_geometry_polygon(&obstacle->m_initial_shape, &local_shape);
+        GEOMETRY_point_t projection = GEOMETRY_polygon_project_point(&local_shape, local_viewer);
+        bool is_on_obstacle
+            = GEOMETRY_is_strictly_in_polygon(local_shape.points, local_shape.nb_points, local_viewer, out_point, NULL)
+              || GEOMETRY_distance(projection, local_viewer) <= tolerance;
+        if (!is_on_obstacle)
+        {
+            is_leaving_obstacle = false;
+        }
+        else if (!is_leaving_obstacle)
+        {
+            // Si le viewer est déjà sur l'obstacle au départ, on le laisse en sortir
+            // (comme les liens forcés du viewer en mode DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS),
+            // mais il ne doit pas le rencontrer de nouveau
+            return true;
+        }
+    }
+    return false;
+}
+
 void dj_dynamic_polygon_solution_deinit(dj_dynamic_polygon_solution_t *solution)
 {
 }
@@ -11,6 +11,7 @@
 
 /* ******************************************************* Includes ****************************************************** */
 
+#include "../dj_config.h"
 #include "../dj_dependencies/dj_dependencies.h"
 #include "../dj_obstacle_importer/dj_obstacle_id.h"
 #include "../dj_viewer/dj_viewer_status.h"
@@ -21,6 +22,19 @@
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Maximum number of dynamic obstacles solved at once
+ * @see dj_obstacle_dynamic_get_positions
+ */
+#define DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE (DYNAMIC_OBSTACLE_COUNT + DJ_DYNAMIC_OBSTACLE_POOL_SIZE)
+
+/**
+ * @brief Maximum number of solutions of a dynamic obstacle
+ * @note The 4 roots of its quartic, reached from a null speed or from the speed of the viewer
+ * @see dj_dynamic_polygon_solution_t
+ */
+#define DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS (8)
+
 /* ************************************************** Public types definition ******************************************** */
 
 /**
@@ -42,17 +56,22 @@ typedef struct
     GEOMETRY_vector_t m_initial_speed;   /**< Initial speed of the obstacle */
     GEOMETRY_vector_t m_acceleration;    /**< Acceleration of the obstacle */
     time32_t m_update_time;              /**< Time of the last update */
+    uint16_t m_shape_radius;             /**< Radius of the circle centered on the origin containing the shape */
 } dj_obstacle_dynamic_t;
 
 /**
  * @brief Structure to store the solutions of the dynamic obstacle
  * @note The solutions are the positions of the obstacle in space time from the viewer position
- * @note There is [0 ; 8] solution(s)
+ * @note There is [0 ; DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS] solution(s)
+ * @note A solution is the shape of the obstacle translated by an offset,
+ *  the shape is not copied but referenced (see dj_obstacle_static_init_with_offset to materialize it)
  */
 typedef struct
 {
-    dj_polygon_t m_solutions[8]; /**< Positions of the obstacle */
-    uint8_t m_nb_solutions;      /**< Number of positions of the obstacle */
+    dj_polygon_t *m_shape; /**< Shape of the obstacle (reference to the initial shape) */
+    /** Translations to apply to the shape for each position */
+    GEOMETRY_point_t m_offsets[DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS];
+    uint8_t m_nb_solutions; /**< Number of positions of the obstacle */
 } dj_dynamic_polygon_solution_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
@@ -105,13 +124,64 @@ void dj_obstacle_dynamic_refresh(dj_obstacle_dynamic_t *obstacle,
  * @param [in] viewer_status Viewer status
  * @param [out] solution Pointer to the solution to fill
  *
- * @note There is [0 ; 8] solution(s)
+ * @note There is [0 ; DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS] solution(s)
  * @see dj_dynamic_polygon_solution_t for more information
  */
 void dj_obstacle_dynamic_get_position(dj_obstacle_dynamic_t *obstacle,
                                       dj_viewer_status_t *viewer_status,
                                       dj_dynamic_polygon_solution_t *solution);
 
+/**
+ * @brief Function to get the positions of several dynamic obstacles in space time at once
+ * @note The polynomials of all the obstacles are solved in a single batch (see dj_quartic_find_roots)
+ * @see dj_obstacle_dynamic_get_position
+ *
+ * @param [in] obstacles Pointers to the dynamic obstacles
+ * @param [in] nb_obstacles Number of obstacles (at most DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE)
+ * @param [in] viewer_status Viewer status
+ * @param [out] solutions Solutions to fill (one per obstacle)
+ */
+void dj_obstacle_dynamic_get_positions(dj_obstacle_dynamic_t **obstacles,
+                                       uint16_t nb_obstacles,
+                                       dj_viewer_status_t *viewer_status,
+                                       dj_dynamic_polygon_solution_t *solutions);
+
+/**
+ * @brief Function to know if a dynamic obstacle may be reached by the viewer before it expires
+ * @note This is a conservative broad phase: it can return true for an obstacle that will never be met,
+ *  but never returns false for an obstacle that could be met
+ * @details The area swept by the obstacle during its lifetime is bounded by a disc,
+ *  the area reachable by the viewer during the same horizon is bounded by another disc,
+ *  both are limited to the playground.
+ *
+ * @param obstacle Pointer to the dynamic obstacle
+ * @param viewer_status Viewer status
+ * @return true if the obstacle may be reached, false if it can be skipped
+ */
+bool dj_obstacle_dynamic_may_be_reached(dj_obstacle_dynamic_t *obstacle, dj_viewer_status_t *viewer_status);
+
+/**
+ * @brief Function to know if a dynamic obstacle meets the viewer while it goes straight to a target
+ * @details The viewer follows the profile of the last segment of a path : it stops and rotates first if its speed
+ *  isn't in the direction of the target (see is_pre_rotation_needed), then it accelerates and brakes to stop on
+ *  the target in the duration of the segment (see dj_graph_segment_get_duration).
+ *  The obstacle follows its constant acceleration trajectory.
+ *  The traversal is sampled every DJ_CONTINUOUS_VALIDATION_STEP_MS and at each sample, the separation between
+ *  the viewer and the bounding circle of the obstacle is computed. When the separation is smaller than what
+ *  both can travel in half a step, the viewer is tested against the shape in the obstacle local coordinates.
+ * @note The samples after the end of the lifetime of the obstacle are ignored
+ * @note If the viewer starts on the obstacle, the first samples on it are ignored to let it leave the obstacle
+ * @note It validates the links leaving the viewer in DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS
+ *
+ * @param obstacle Pointer to the dynamic obstacle
+ * @param viewer_status Status of the viewer at the beginning of the segment
+ * @param target End of the segment
+ * @return true if the obstacle blocks the segment, false otherwise
+ */
+bool dj_obstacle_dynamic_is_segment_blocked(dj_obstacle_dynamic_t *obstacle,
+                                            dj_viewer_status_t *viewer_status,
+                                            GEOMETRY_point_t *target);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -24,10 +24,49 @@
 
 MAGIC_ARRAY_SRC(static_obstacles_list, dj_obstacle_static_t);
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
 static void compute_dynamic_obstacles(dj_obstacle_manager_t *manager, dj_viewer_status_t *viewer);
+static void add_dynamic_obstacle_to_batch(dj_obstacle_dynamic_t **batch,
+                                          uint16_t *nb_obstacles,
+                                          dj_viewer_status_t *viewer,
+                                          dj_obstacle_dynamic_t *obstacle);
+#endif
 
 /* ************************************************** Private variables ************************************************** */
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
+/**
+ * @brief Add a dynamic obstacle to the batch of obstacles to solve if it may be reached by the viewer
+ *
+ * @param batch The batch of dynamic obstacles to solve
+ * @param nb_obstacles The number of obstacles in the batch (incremented if the obstacle is added)
+ * @param viewer The viewer status
+ * @param obstacle The dynamic obstacle (NULL if the obstacle is not available, nothing is done)
+ */
+static void add_dynamic_obstacle_to_batch(dj_obstacle_dynamic_t **batch,
+                                          uint16_t *nb_obstacles,
+                                          dj_viewer_status_t *viewer,
+                                          dj_obstacle_dynamic_t *obstacle)
+{
+    if (obstacle == NULL)
+    {
+        return;
+    }
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_BROAD_PHASE
+    // Skip the obstacles that cannot be reached before they expire
+    if (!dj_obstacle_dynamic_may_be_reached(obstacle, viewer))
+    {
+        return;
+    }
+#endif
+    if (*nb_obstacles >= DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE)
+    {
+        dj_error_printf("Too many dynamic obstacles to compute\n");
+        return;
+    }
+    batch[(*nb_obstacles)++] = obstacle;
+}
+
 /**
  * @brief Compute the dynamic obstacles to get the static obstacles in space time (so from the point of view of a viewer)
  * @see dj_obstacle_dynamic_get_position
@@ -69,26 +108,59 @@ static void compute_dynamic_obstacles(dj_obstacle_manager_t *manager, dj_viewer_
         static_obstacles_list_clear(&manager->m_computed_obstacles);
     }
 
-    for (dj_dynamic_obstacle_id_e obstacle_id = 0; obstacle_id < DYNAMIC_OBSTACLE_COUNT; obstacle_id++)
+    // Gather all the dynamic obstacles which may be reached to solve them at once
+    dj_obstacle_dynamic_t *batch[DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE];
+    uint16_t nb_obstacles = 0;
+    if (manager->m_dynamic_obstacles_enabled)
+    {
+        // Imported dynamic obstacles (identified by their ID)
+        for (dj_dynamic_obstacle_id_e obstacle_id = 0; obstacle_id < DYNAMIC_OBSTACLE_COUNT; obstacle_id++)
+        {
+            add_dynamic_obstacle_to_batch(
+                batch, &nb_obstacles, viewer, dj_obstacle_importer_get_dynamic_obstacle(obstacle_id));
+        }
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+        // Pooled dynamic obstacles (only the live ones are visited)
+        uint16_t nb_pooled_obstacles = dj_obstacle_importer_get_pooled_dynamic_obstacle_count();
+        for (uint16_t i = 0; i < nb_pooled_obstacles; i++)
+        {
+            add_dynamic_obstacle_to_batch(
+                batch, &nb_obstacles, viewer, dj_obstacle_importer_get_pooled_dynamic_obstacle(i));
+        }
+#endif
+    }
+
+    // Compute the solutions of all the obstacles (see dj_obstacle_dynamic_get_positions)
+    dj_dynamic_polygon_solution_t solutions[DJ_OBSTACLE_DYNAMIC_MAX_BATCH_SIZE];
+    dj_obstacle_dynamic_get_positions(batch, nb_obstacles, viewer, solutions);
+
+    // Convert the solutions to static obstacles and add them to the manager
+    // (The shape is translated directly into the manager list, it is the only copy of the shape)
+    uint32_t nb_dropped_solutions = 0;
+    for (uint16_t obstacle_index = 0; obstacle_index < nb_obstacles; obstacle_index++)
     {
-        dj_obstacle_dynamic_t *new_obstacle_to_add = dj_obstacle_importer_get_dynamic_obstacle(obstacle_id);
-        if (new_obstacle_to_add != NULL)
+        for (uint32_t i = 0; i < solutions[obstacle_index].m_nb_solutions; i++)
         {
-            // Compute the solutions (see dj_obstacle_dynamic_get_position)
-            dj_dynamic_polygon_solution_t solutions;
-            dj_obstacle_dynamic_get_position(new_obstacle_to_add, viewer, &solutions);
-            // Convert the solutions to static obstacles and add them to the manager
-            for (uint32_t i = 0; i < solutions.m_nb_solutions; i++)
+            // The list can only be full with the imported obstacles (see DJ_OBSTACLE_MANAGER_MAX_STATIC_OBSTACLES)
+            if (static_obstacles_list_is_full(&manager->m_computed_obstacles))
             {
-                dj_obstacle_static_t *new_obstacle_added = static_obstacles_list_add(&manager->m_computed_obstacles, NULL);
-                dj_control_non_null(new_obstacle_added, );
-                dj_obstacle_static_init(new_obstacle_added,
-                                        &solutions.m_solutions[i],
-                                        STATIC_OBSTACLE_UNKNOWN_ID,
-                                        new_obstacle_to_add->m_is_enabled);
+                nb_dropped_solutions++;
+                continue;
             }
+            dj_obstacle_static_t *new_obstacle_added = static_obstacles_list_add(&manager->m_computed_obstacles, NULL);
+            dj_obstacle_static_init_with_offset(new_obstacle_added,
+                                                solutions[obstacle_index].m_shape,
+                                                solutions[obstacle_index].m_offsets[i],
+                                                STATIC_OBSTACLE_UNKNOWN_ID,
+                                                batch[obstacle_index]->m_is_enabled);
         }
     }
+    if (nb_dropped_solutions != 0)
+    {
+        dj_error_printf("DJ : Obstacle manager full, %d positions of dynamic obstacles ignored "
+                        "(see DJ_OBSTACLE_MANAGER_MAX_IMPORTED_OBSTACLES)\n",
+                        (int)nb_dropped_solutions);
+    }
     // The last viewer is valid
     manager->m_last_viewer_is_valid = true;
     // The obstacles are computed, so the manager does not need to recompute them if the viewer does not change
@@ -96,6 +168,7 @@ static void compute_dynamic_obstacles(dj_obstacle_manager_t *manager, dj_viewer_
     // Save the last viewer
     manager->m_last_computed_viewer = *viewer;
 }
+#endif
 
 /* ********************************************** Private functions definitions ****************************************** */
 
@@ -110,6 +183,7 @@ void dj_obstacle_manager_init(dj_obstacle_manager_t *manager)
     manager->m_must_recompute = true;
     manager->m_static_obstacles_added = false;
     manager->m_nb_static_obstacles = 0;
+    manager->m_dynamic_obstacles_enabled = true;
 }
 
 void dj_obstacle_manager_deinit(dj_obstacle_manager_t *manager)
@@ -130,9 +204,23 @@ void dj_obstacle_manager_clear_obstacles(dj_obstacle_manager_t *manager)
 
     static_obstacles_list_clear(&manager->m_computed_obstacles);
     manager->m_static_obstacles_added = false;
+    manager->m_last_viewer_is_valid = false;
     manager->m_must_recompute = true;
 }
 
+void dj_obstacle_manager_enable_dynamic_obstacles(dj_obstacle_manager_t *manager, bool enable)
+{
+    dj_control_non_null(manager, );
+
+    if (manager->m_dynamic_obstacles_enabled != enable)
+    {
+        manager->m_dynamic_obstacles_enabled = enable;
+        // The dynamic obstacles computed for the last viewer are no longer valid
+        manager->m_last_viewer_is_valid = false;
+        manager->m_must_recompute = true;
+    }
+}
+
 static_obstacles_list_t *dj_obstacle_manager_get_all_obstacles(dj_obstacle_manager_t *manager,
                                                                dj_viewer_status_t *viewer_status)
 {
@@ -167,6 +255,9 @@ static_obstacles_list_t *dj_obstacle_manager_get_all_obstacles(dj_obstacle_manag
         }
         manager->m_static_obstacles_added = true;
     }
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS)
+    // In continuous mode, the dynamic obstacles are not converted into static obstacles
+    // (see dj_obstacle_manager_is_segment_blocked)
     if (viewer_status != NULL)
     {
         if (manager->m_must_recompute || viewer_status->m_time != manager->m_last_computed_viewer.m_time
@@ -178,6 +269,7 @@ static_obstacles_list_t *dj_obstacle_manager_get_all_obstacles(dj_obstacle_manag
             compute_dynamic_obstacles(manager, viewer_status);
         }
     }
+#endif
 
     dj_mark_end_time(DJ_MARK_OBSTACLE_MANAGER_GET_ALL_OBSTACLES);
 
@@ -200,4 +292,45 @@ bool dj_obstacle_manager_is_point_on_obstacle(static_obstacles_list_t *obstacles
     return false;
 }
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+bool dj_obstacle_manager_is_segment_blocked(dj_obstacle_manager_t *manager,
+                                            dj_viewer_status_t *viewer_status,
+                                            GEOMETRY_point_t *target)
+{
+    dj_control_non_null(manager, false);
+    dj_control_non_null(viewer_status, false);
+    dj_control_non_null(target, false);
+
+    if (!manager->m_dynamic_obstacles_enabled)
+    {
+        return false;
+    }
+
+    // Imported dynamic obstacles (identified by their ID)
+    for (dj_dynamic_obstacle_id_e obstacle_id = 0; obstacle_id < DYNAMIC_OBSTACLE_COUNT; obstacle_id++)
+    {
+        dj_obstacle_dynamic_t *obstacle = dj_obstacle_importer_get_dynamic_obstacle(obstacle_id);
+        if (obstacle != NULL && obstacle->m_is_enabled
+            && dj_obstacle_dynamic_is_segment_blocked(obstacle, viewer_status, target))
+        {
+            return true;
+        }
+    }
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    // Pooled dynamic obstacles
+    uint16_t nb_pooled_obstacles = dj_obstacle_importer_get_pooled_dynamic_obstacle_count();
+    for (uint16_t i = 0; i < nb_pooled_obstacles; i++)
+    {
+        dj_obstacle_dynamic_t *obstacle = dj_obstacle_importer_get_pooled_dynamic_obstacle(i);
+        if (obstacle != NULL && obstacle->m_is_enabled
+            && dj_obstacle_dynamic_is_segment_blocked(obstacle, viewer_status, target))
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+#endif
+
 /* ******************************************* Public callback functions declarations ************************************ */
@@ -22,8 +22,11 @@
 
 /**
  * @brief Maximum number of computed obstacles
+ * @note Each obstacle of the pool reserves a place for each of its solutions, so a full pool always fits
  */
-#define DJ_OBSTACLE_MANAGER_MAX_STATIC_OBSTACLES (DJ_OBSTACLE_MANAGER_MAX_IMPORTED_OBSTACLES + STATIC_OBSTACLE_COUNT)
+#define DJ_OBSTACLE_MANAGER_MAX_STATIC_OBSTACLES                                                                            \
+    (DJ_OBSTACLE_MANAGER_MAX_IMPORTED_OBSTACLES + STATIC_OBSTACLE_COUNT                                                     \
+     + DJ_DYNAMIC_OBSTACLE_POOL_SIZE * DJ_OBSTACLE_DYNAMIC_MAX_SOLUTIONS)
 
 /* ************************************************** Public types definition ******************************************** */
 
@@ -59,6 +62,10 @@ typedef struct
      * @brief Number of static obstacles added in the computed obstacles list
      */
     uint16_t m_nb_static_obstacles;
+    /**
+     * @brief Flag to know if the dynamic obstacles are taken into account (see dj_obstacle_manager_enable_dynamic_obstacles)
+     */
+    bool m_dynamic_obstacles_enabled;
 } dj_obstacle_manager_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
@@ -96,6 +103,17 @@ static_obstacles_list_t *dj_obstacle_manager_get_all_obstacles(dj_obstacle_manag
  */
 void dj_obstacle_manager_clear_obstacles(dj_obstacle_manager_t *manager);
 
+/**
+ * @brief Function to take into account or to ignore the dynamic obstacles in this obstacle manager only
+ * @note Unlike dj_obstacle_importer_enable_dynamic_obstacles, the other obstacle managers aren't affected,
+ *       so the planners can enable or disable the dynamic obstacles for their own queries
+ * @note By default, the dynamic obstacles are taken into account
+ *
+ * @param manager The obstacle manager object
+ * @param enable true to take the dynamic obstacles into account, false to ignore them
+ */
+void dj_obstacle_manager_enable_dynamic_obstacles(dj_obstacle_manager_t *manager, bool enable);
+
 /**
  * @brief Function to check if a point is on an obstacle
  *
@@ -106,6 +124,22 @@ void dj_obstacle_manager_clear_obstacles(dj_obstacle_manager_t *manager);
  */
 bool dj_obstacle_manager_is_point_on_obstacle(static_obstacles_list_t *obstacles, GEOMETRY_point_t point);
 
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS)
+/**
+ * @brief Function to check if a segment leaving the viewer is blocked by a dynamic obstacle in space time
+ * @see dj_obstacle_dynamic_is_segment_blocked
+ *
+ * @param manager The obstacle manager object
+ * @param viewer_status The viewer status at the beginning of the segment
+ * @param target The end of the segment
+ *
+ * @return bool True if an enabled dynamic obstacle meets the viewer on the segment, false otherwise
+ */
+bool dj_obstacle_manager_is_segment_blocked(dj_obstacle_manager_t *manager,
+                                            dj_viewer_status_t *viewer_status,
+                                            GEOMETRY_point_t *target);
+#endif
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
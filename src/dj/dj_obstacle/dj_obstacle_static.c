@@ -43,6 +43,25 @@ void dj_obstacle_static_init(dj_obstacle_static_t *obstacle,
     }
 }
 
+void dj_obstacle_static_init_with_offset(dj_obstacle_static_t *obstacle,
+                                         dj_polygon_t *shape,
+                                         GEOMETRY_point_t offset,
+                                         dj_static_obstacle_id_e id,
+                                         bool is_enabled)
+{
+    dj_control_non_null(obstacle, );
+    dj_control_non_null(shape, );
+
+    dj_obstacle_init((dj_obstacle_t *)obstacle, DJ_OBSTACLE_TYPE_STATIC, is_enabled);
+    obstacle->m_id = id;
+    obstacle->m_shape.nb_points = shape->nb_points;
+    for (uint16_t i = 0; i < shape->nb_points; i++)
+    {
+        obstacle->m_shape.points[i]
+            = (GEOMETRY_point_t){.x = shape->points[i].x + offset.x, .y = shape->points[i].y + offset.y};
+    }
+}
+
 void dj_obstacle_static_deinit(dj_obstacle_static_t *obstacle)
 {
     dj_control_non_null(obstacle, );
@@ -54,6 +54,22 @@ void dj_obstacle_static_init(dj_obstacle_static_t *obstacle,
                              dj_static_obstacle_id_e id,
                              bool is_enabled);
 
+/**
+ * @brief Function to initialize a static obstacle from a shape translated by an offset
+ * @note The translation is applied while copying the shape, so the shape is only read once
+ *
+ * @param obstacle Pointer to the obstacle to initialize
+ * @param shape Polygon representing the shape of the obstacle (in the obstacle local coordinates)
+ * @param offset Translation to apply to the shape
+ * @param id ID of the obstacle (must be unique)
+ * @param is_enabled true if the obstacle is enabled, false otherwise
+ */
+void dj_obstacle_static_init_with_offset(dj_obstacle_static_t *obstacle,
+                                         dj_polygon_t *shape,
+                                         GEOMETRY_point_t offset,
+                                         dj_static_obstacle_id_e id,
+                                         bool is_enabled);
+
 /**
  * @brief Function to deinitialize a static obstacle
  *
@@ -0,0 +1,157 @@
+/**
+ * @file dj_quartic.c
+ * @brief Batched search of the roots of quartic polynomials by sign bracketing
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_quartic.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "dj_quartic.h"
+#include "../dj_logs/dj_logs.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#if DJ_ENABLE_SIMD && defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define DJ_QUARTIC_LANES 8
+#elif DJ_ENABLE_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define DJ_QUARTIC_LANES 4
+#elif DJ_ENABLE_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DJ_QUARTIC_LANES 4
+#else
+#define DJ_QUARTIC_LANES 1
+#endif
+
+/* **************************************************** Private macros *************************************************** */
+
+/**
+ * @brief Mask with one bit set per lane
+ */
+#define ALL_LANES_MASK ((uint32_t)((1u << DJ_QUARTIC_LANES) - 1))
+
+/* ************************************************ Private type definition ********************************************** */
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static uint32_t evaluate_signs(dj_quartic_t *quartic, float first_time, float step);
+static void find_roots(dj_quartic_t *quartic, dj_quartic_roots_t *roots, float step);
+
+/* ************************************************** Private variables ************************************************** */
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to evaluate the sign of a polynomial on DJ_QUARTIC_LANES consecutive samples
+ *
+ * @param quartic Polynomial to evaluate
+ * @param first_time Time of the first sample
+ * @param step Sampling step
+ * @return uint32_t Bit i is set if the polynomial is strictly positive at first_time + i * step
+ */
+static uint32_t evaluate_signs(dj_quartic_t *quartic, float first_time, float step)
+{
+#if DJ_QUARTIC_LANES == 8
+    __m256 t = _mm256_add_ps(_mm256_set1_ps(first_time),
+                             _mm256_mul_ps(_mm256_set1_ps(step), _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7)));
+    // Horner : (((a * t + b) * t + c) * t + d) * t + e
+    __m256 p = _mm256_fmadd_ps(_mm256_set1_ps(quartic->m_a), t, _mm256_set1_ps(quartic->m_b));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(quartic->m_c));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(quartic->m_d));
+    p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(quartic->m_e));
+    return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(p, _mm256_setzero_ps(), _CMP_GT_OQ));
+#elif DJ_QUARTIC_LANES == 4 && defined(__SSE2__)
+    __m128 t = _mm_add_ps(_mm_set1_ps(first_time), _mm_mul_ps(_mm_set1_ps(step), _mm_setr_ps(0, 1, 2, 3)));
+    // Horner : (((a * t + b) * t + c) * t + d) * t + e
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(quartic->m_a), t), _mm_set1_ps(quartic->m_b));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(quartic->m_c));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(quartic->m_d));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(quartic->m_e));
+    return (uint32_t)_mm_movemask_ps(_mm_cmpgt_ps(p, _mm_setzero_ps()));
+#elif DJ_QUARTIC_LANES == 4
+    static const float lane_index[4] = {0, 1, 2, 3};
+    static const uint32_t lane_bit[4] = {1, 2, 4, 8};
+    float32x4_t t = vmlaq_n_f32(vdupq_n_f32(first_time), vld1q_f32(lane_index), step);
+    // Horner : (((a * t + b) * t + c) * t + d) * t + e
+    float32x4_t p = vmlaq_n_f32(vdupq_n_f32(quartic->m_b), t, quartic->m_a);
+    p = vmlaq_f32(vdupq_n_f32(quartic->m_c), p, t);
+    p = vmlaq_f32(vdupq_n_f32(quartic->m_d), p, t);
+    p = vmlaq_f32(vdupq_n_f32(quartic->m_e), p, t);
+    // There is no movemask in NEON, so the lane bits are summed
+    uint32x4_t bits = vandq_u32(vcgtq_f32(p, vdupq_n_f32(0)), vld1q_u32(lane_bit));
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+    return vget_lane_u32(sum, 0);
+#else
+    float t = first_time;
+    float p = (((quartic->m_a * t + quartic->m_b) * t + quartic->m_c) * t + quartic->m_d) * t + quartic->m_e;
+    return (p > 0) ? 1 : 0;
+#endif
+}
+
+/**
+ * @brief Function to find the roots of a quartic polynomial by sign bracketing
+ *
+ * @param [in] quartic Polynomial to solve
+ * @param [out] roots Roots of the polynomial
+ * @param [in] step Sampling step
+ */
+static void find_roots(dj_quartic_t *quartic, dj_quartic_roots_t *roots, float step)
+{
+    roots->m_nb_roots = 0;
+    if (quartic->m_end_time <= quartic->m_start_time)
+    {
+        return;
+    }
+    uint32_t nb_samples = (uint32_t)ceilf((quartic->m_end_time - quartic->m_start_time) / step);
+
+    // The sign before the first sample is the sign at t = 0, so the sign of e
+    bool sign = quartic->m_e > 0;
+    for (uint32_t sample = 0; sample < nb_samples; sample += DJ_QUARTIC_LANES)
+    {
+        float first_time = quartic->m_start_time + sample * step;
+        uint32_t signs = evaluate_signs(quartic, first_time, step);
+        uint32_t nb_lanes = MIN(DJ_QUARTIC_LANES, nb_samples - sample);
+        uint32_t lanes_mask = (nb_lanes == DJ_QUARTIC_LANES) ? ALL_LANES_MASK : ((1u << nb_lanes) - 1);
+
+        // Fast path : all the samples have the same sign as the previous one
+        if ((signs & lanes_mask) == (sign ? lanes_mask : 0))
+        {
+            continue;
+        }
+        for (uint32_t lane = 0; lane < nb_lanes; lane++)
+        {
+            bool new_sign = (signs >> lane) & 1;
+            if (new_sign != sign)
+            {
+                sign = new_sign;
+                roots->m_roots[roots->m_nb_roots++] = first_time + lane * step;
+                if (roots->m_nb_roots >= DJ_QUARTIC_MAX_ROOTS)
+                {
+                    // All the roots are found
+                    return;
+                }
+            }
+        }
+    }
+}
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+void dj_quartic_find_roots(dj_quartic_t *quartics, dj_quartic_roots_t *roots, uint16_t nb_quartics, float step)
+{
+    dj_control_non_null(quartics, );
+    dj_control_non_null(roots, );
+
+    for (uint16_t i = 0; i < nb_quartics; i++)
+    {
+        find_roots(&quartics[i], &roots[i], step);
+    }
+}
+
+/* ******************************************* Public callback functions declarations ************************************ */
@@ -0,0 +1,70 @@
+/**
+ * @file dj_quartic.h
+ * @brief Batched search of the roots of quartic polynomials by sign bracketing
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_quartic.c
+ */
+
+#ifndef __DJ_QUARTIC_H__
+#define __DJ_QUARTIC_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../dj_config.h"
+#include "../dj_dependencies/dj_dependencies.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/**
+ * @brief Maximum number of roots found for a quartic polynomial
+ */
+#define DJ_QUARTIC_MAX_ROOTS 4
+
+/* ************************************************** Public types definition ******************************************** */
+
+/**
+ * @brief Quartic polynomial a*t^4 + b*t^3 + c*t^2 + d*t + e to solve on [m_start_time ; m_end_time[
+ */
+typedef struct
+{
+    float m_a;          /**< Coefficient of t^4 */
+    float m_b;          /**< Coefficient of t^3 */
+    float m_c;          /**< Coefficient of t^2 */
+    float m_d;          /**< Coefficient of t */
+    float m_e;          /**< Constant coefficient */
+    float m_start_time; /**< Start of the search interval */
+    float m_end_time;   /**< End of the search interval (excluded) */
+} dj_quartic_t;
+
+/**
+ * @brief Roots of a quartic polynomial
+ * @note A root is the first sample after a sign change, so it is precise to the sampling step
+ */
+typedef struct
+{
+    float m_roots[DJ_QUARTIC_MAX_ROOTS]; /**< Roots in ascending order */
+    uint8_t m_nb_roots;                  /**< Number of roots */
+} dj_quartic_roots_t;
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+/**
+ * @brief Function to find the roots of several quartic polynomials at once
+ * @details Each polynomial is sampled every step from its start time and the sign of each sample is compared
+ *  to the sign of the previous one. The sign before the first sample is the sign of e (so the sign at t = 0).
+ *  The samples are evaluated by vectors of 8 (AVX2), 4 (SSE2 / NEON) or 1 (scalar fallback).
+ *
+ * @param [in] quartics Polynomials to solve
+ * @param [out] roots Roots of each polynomial
+ * @param [in] nb_quartics Number of polynomials
+ * @param [in] step Sampling step
+ */
+void dj_quartic_find_roots(dj_quartic_t *quartics, dj_quartic_roots_t *roots, uint16_t nb_quartics, float step);
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
@@ -0,0 +1,172 @@
+/**
+ * @file dj_dynamic_obstacle_pool.c
+ * @brief Pool of dynamic obstacles allocated at runtime and identified by handles
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_dynamic_obstacle_pool.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "dj_dynamic_obstacle_pool.h"
+
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+
+#include "../dj_logs/dj_logs.h"
+#include "dj_obstacle_id.h"
+
+#include <stdlib.h>
+
+/* **************************************************** Private macros *************************************************** */
+
+/**
+ * @brief Macros to pack and unpack a handle
+ * @see dj_dynamic_obstacle_handle_t
+ */
+#define HANDLE_CREATE(slot, generation) ((dj_dynamic_obstacle_handle_t)(((uint32_t)(generation) << 16) | (slot)))
+#define HANDLE_GET_SLOT(handle) ((uint16_t)((handle)&0xFFFF))
+#define HANDLE_GET_GENERATION(handle) ((uint16_t)((handle) >> 16))
+
+/* ************************************************ Private type definition ********************************************** */
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static bool handle_is_valid(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle);
+
+/* ************************************************** Private variables ************************************************** */
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to check if a handle refers to a live obstacle of the pool
+ *
+ * @param pool Pool of the obstacle
+ * @param handle Handle to check
+ * @return true if the handle is valid, false if it is stale or invalid
+ */
+static bool handle_is_valid(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle)
+{
+    uint16_t slot = HANDLE_GET_SLOT(handle);
+    if (handle == DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE || slot >= DJ_DYNAMIC_OBSTACLE_POOL_SIZE)
+    {
+        return false;
+    }
+    // The generation of the handle must be the current one of the slot
+    // and the slot must be in the live list
+    return pool->m_generations[slot] == HANDLE_GET_GENERATION(handle)
+           && pool->m_live_positions[slot] < pool->m_nb_live_slots
+           && pool->m_live_slots[pool->m_live_positions[slot]] == slot;
+}
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+void dj_dynamic_obstacle_pool_init(dj_dynamic_obstacle_pool_t *pool)
+{
+    dj_control_non_null(pool, );
+
+    pool->m_nb_live_slots = 0;
+    pool->m_nb_free_slots = DJ_DYNAMIC_OBSTACLE_POOL_SIZE;
+    for (uint16_t i = 0; i < DJ_DYNAMIC_OBSTACLE_POOL_SIZE; i++)
+    {
+        pool->m_generations[i] = 0;
+        // The first allocated slot will be the slot 0
+        pool->m_free_slots[i] = DJ_DYNAMIC_OBSTACLE_POOL_SIZE - 1 - i;
+        pool->m_live_positions[i] = DJ_DYNAMIC_OBSTACLE_POOL_SIZE;
+    }
+}
+
+void dj_dynamic_obstacle_pool_deinit(dj_dynamic_obstacle_pool_t *pool)
+{
+    dj_control_non_null(pool, );
+
+    while (pool->m_nb_live_slots > 0)
+    {
+        uint16_t slot = pool->m_live_slots[pool->m_nb_live_slots - 1];
+        dj_dynamic_obstacle_pool_free(pool, HANDLE_CREATE(slot, pool->m_generations[slot]));
+    }
+}
+
+dj_dynamic_obstacle_handle_t dj_dynamic_obstacle_pool_alloc(dj_dynamic_obstacle_pool_t *pool,
+                                                            dj_polygon_t *initial_shape,
+                                                            bool is_enabled)
+{
+    dj_control_non_null(pool, DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE);
+    dj_control_non_null(initial_shape, DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE);
+
+    if (pool->m_nb_free_slots == 0)
+    {
+        dj_error_printf("Dynamic obstacle pool is full\n");
+        return DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE;
+    }
+
+    // Pop a free slot and push it in the live list
+    uint16_t slot = pool->m_free_slots[--pool->m_nb_free_slots];
+    pool->m_live_positions[slot] = pool->m_nb_live_slots;
+    pool->m_live_slots[pool->m_nb_live_slots++] = slot;
+
+    dj_obstacle_dynamic_init(&pool->m_slots[slot],
+                             initial_shape,
+                             &(GEOMETRY_point_t){-10000, -10000},
+                             &(GEOMETRY_vector_t){0, 0},
+                             &(GEOMETRY_vector_t){0, 0},
+                             DYNAMIC_OBSTACLE_POOLED_ID,
+                             is_enabled);
+
+    return HANDLE_CREATE(slot, pool->m_generations[slot]);
+}
+
+void dj_dynamic_obstacle_pool_free(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle)
+{
+    dj_control_non_null(pool, );
+
+    if (!handle_is_valid(pool, handle))
+    {
+        dj_error_printf("Invalid dynamic obstacle handle\n");
+        return;
+    }
+    uint16_t slot = HANDLE_GET_SLOT(handle);
+    dj_obstacle_dynamic_deinit(&pool->m_slots[slot]);
+
+    // Remove the slot from the live list by moving the last live slot to its position
+    uint16_t position = pool->m_live_positions[slot];
+    uint16_t last_slot = pool->m_live_slots[--pool->m_nb_live_slots];
+    pool->m_live_slots[position] = last_slot;
+    pool->m_live_positions[last_slot] = position;
+    pool->m_live_positions[slot] = DJ_DYNAMIC_OBSTACLE_POOL_SIZE;
+
+    // The old handles of this slot become stale
+    pool->m_generations[slot]++;
+    pool->m_free_slots[pool->m_nb_free_slots++] = slot;
+}
+
+dj_obstacle_dynamic_t *dj_dynamic_obstacle_pool_get(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle)
+{
+    dj_control_non_null(pool, NULL);
+
+    if (!handle_is_valid(pool, handle))
+    {
+        return NULL;
+    }
+    return &pool->m_slots[HANDLE_GET_SLOT(handle)];
+}
+
+uint16_t dj_dynamic_obstacle_pool_get_live_count(dj_dynamic_obstacle_pool_t *pool)
+{
+    dj_control_non_null(pool, 0);
+    return pool->m_nb_live_slots;
+}
+
+dj_obstacle_dynamic_t *dj_dynamic_obstacle_pool_get_live(dj_dynamic_obstacle_pool_t *pool, uint16_t live_index)
+{
+    dj_control_non_null(pool, NULL);
+
+    if (live_index >= pool->m_nb_live_slots)
+    {
+        return NULL;
+    }
+    return &pool->m_slots[pool->m_live_slots[live_index]];
+}
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * @file dj_dynamic_obstacle_pool.h
+ * @brief Pool of dynamic obstacles allocated at runtime and identified by handles
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_dynamic_obstacle_pool.c
+ */
+
+#ifndef __DJ_DYNAMIC_OBSTACLE_POOL_H__
+#define __DJ_DYNAMIC_OBSTACLE_POOL_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../dj_config.h"
+#include "../dj_dependencies/dj_dependencies.h"
+#include "../dj_obstacle/dj_obstacle_dynamic.h"
+#include "../dj_obstacle/dj_polygon.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/**
+ * @brief Invalid handle, returned when the pool is full
+ */
+#define DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE ((dj_dynamic_obstacle_handle_t)(-1))
+
+/* ************************************************** Public types definition ******************************************** */
+
+/**
+ * @brief Handle of a pooled dynamic obstacle
+ * @details The 16 low bits are the slot of the obstacle in the pool,
+ *  the 16 high bits are the generation of the slot when the obstacle was allocated.
+ *  A handle becomes stale as soon as its obstacle is removed, even if the slot is reused.
+ */
+typedef uint32_t dj_dynamic_obstacle_handle_t;
+
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+
+/**
+ * @brief Pool of dynamic obstacles
+ * @note Allocation, removal and access by handle are O(1)
+ * @note Live obstacles are kept packed so the iteration only visits live entries
+ */
+typedef struct
+{
+    /**
+     * @brief Storage of the obstacles
+     */
+    dj_obstacle_dynamic_t m_slots[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    /**
+     * @brief Generation of each slot (incremented at each removal)
+     */
+    uint16_t m_generations[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    /**
+     * @brief Stack of the free slots
+     */
+    uint16_t m_free_slots[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    /**
+     * @brief Number of free slots in the stack
+     */
+    uint16_t m_nb_free_slots;
+    /**
+     * @brief Packed list of the live slots
+     */
+    uint16_t m_live_slots[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    /**
+     * @brief Position of each slot in the packed list of the live slots
+     */
+    uint16_t m_live_positions[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    /**
+     * @brief Number of live obstacles
+     */
+    uint16_t m_nb_live_slots;
+} dj_dynamic_obstacle_pool_t;
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+/**
+ * @brief Function to initialize a dynamic obstacle pool
+ *
+ * @param pool Pool to initialize
+ */
+void dj_dynamic_obstacle_pool_init(dj_dynamic_obstacle_pool_t *pool);
+
+/**
+ * @brief Function to deinitialize a dynamic obstacle pool
+ * @note All the live obstacles are removed
+ *
+ * @param pool Pool to deinitialize
+ */
+void dj_dynamic_obstacle_pool_deinit(dj_dynamic_obstacle_pool_t *pool);
+
+/**
+ * @brief Function to allocate a dynamic obstacle in the pool
+ * @note After the allocation, the obstacle will not have any position, speed or acceleration, so you must refresh it
+ *
+ * @param pool Pool to allocate the obstacle in
+ * @param initial_shape Shape of the obstacle (centered on the origin)
+ * @param is_enabled true if the obstacle is enabled, false otherwise
+ * @return dj_dynamic_obstacle_handle_t Handle of the obstacle, DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE if the pool is full
+ */
+dj_dynamic_obstacle_handle_t dj_dynamic_obstacle_pool_alloc(dj_dynamic_obstacle_pool_t *pool,
+                                                            dj_polygon_t *initial_shape,
+                                                            bool is_enabled);
+
+/**
+ * @brief Function to remove a dynamic obstacle from the pool
+ *
+ * @param pool Pool to remove the obstacle from
+ * @param handle Handle of the obstacle to remove
+ */
+void dj_dynamic_obstacle_pool_free(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle);
+
+/**
+ * @brief Function to get a dynamic obstacle from its handle
+ *
+ * @param pool Pool of the obstacle
+ * @param handle Handle of the obstacle
+ * @return dj_obstacle_dynamic_t* The obstacle, NULL if the handle is stale or invalid
+ */
+dj_obstacle_dynamic_t *dj_dynamic_obstacle_pool_get(dj_dynamic_obstacle_pool_t *pool, dj_dynamic_obstacle_handle_t handle);
+
+/**
+ * @brief Function to get the number of live obstacles in the pool
+ *
+ * @param pool Pool of the obstacles
+ * @return uint16_t Number of live obstacles
+ */
+uint16_t dj_dynamic_obstacle_pool_get_live_count(dj_dynamic_obstacle_pool_t *pool);
+
+/**
+ * @brief Function to get a live obstacle of the pool
+ * @warning The order of the live obstacles changes when an obstacle is removed
+ *
+ * @param pool Pool of the obstacles
+ * @param live_index Index of the obstacle in [0 ; dj_dynamic_obstacle_pool_get_live_count[
+ * @return dj_obstacle_dynamic_t* The obstacle, NULL if the index is out of bounds
+ */
+dj_obstacle_dynamic_t *dj_dynamic_obstacle_pool_get_live(dj_dynamic_obstacle_pool_t *pool, uint16_t live_index);
+
+#endif
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
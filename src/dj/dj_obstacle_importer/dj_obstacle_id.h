@@ -21,6 +21,12 @@
  */
 #define STATIC_OBSTACLE_UNKNOWN_ID ((dj_static_obstacle_id_e)(-1))
 
+/**
+ * @brief Id des obstacles dynamiques alloués dans le pool (ils sont identifiés par leur handle)
+ * @see dj_dynamic_obstacle_handle_t
+ */
+#define DYNAMIC_OBSTACLE_POOLED_ID ((dj_dynamic_obstacle_id_e)(-1))
+
 /* ************************************************** Public types definition ******************************************** */
 
 /**
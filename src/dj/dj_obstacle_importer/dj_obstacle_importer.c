@@ -85,33 +85,29 @@
 
 /* ************************************************ Private type definition ********************************************** */
 
-MAGIC_ARRAY_TYPEDEF(dynamic_obstacles_list, dj_obstacle_dynamic_t, 5);
-
 static void dj_importer_static_init(
     dj_static_obstacle_id_e id, dj_polygon_t *polygon, bool is_enabled, dj_obsrtacle_oversize_mode_e mode, uint8_t margin);
 static void dj_importer_dynamic_init(dj_dynamic_obstacle_id_e id, dj_polygon_t *polygon, bool is_enabled);
-static uint32_t dj_importer_get_static_obstacle_index(dj_static_obstacle_id_e id);
-static uint32_t dj_importer_get_dynamic_obstacle_index(dj_dynamic_obstacle_id_e id);
+static uint32_t dj_importer_get_static_obstacle_index(dj_obstacle_importer_state_t *state, dj_static_obstacle_id_e id);
+static uint32_t dj_importer_get_dynamic_obstacle_index(dj_obstacle_importer_state_t *state, dj_dynamic_obstacle_id_e id);
+static dj_obstacle_importer_state_t *dj_importer_get_read_state(void);
 
 /* ********************************************* Private functions declarations ****************************************** */
 
 /* ************************************************** Private variables ************************************************** */
 
 /**
- * @brief List of static obstacles
- */
-static static_obstacles_list_t static_obstacles;
-
-/**
- * @brief List of dynamic obstacles
+ * @brief Obstacles, modified by the imports
  */
-static dynamic_obstacles_list_t dynamic_obstacles;
+static dj_obstacle_importer_state_t obstacles DJ_DEP_HEAP_VARS_SUFFIX = {.m_dynamic_obstacles_enabled = true};
 
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_PLANNER_SERVICE_THREAD
 /**
- * @brief Enable or disable the dynamic obstacles
- * @see dj_obstacle_importer_enable_dynamic_obstacles
+ * @brief Snapshot of the obstacles read by the current thread (NULL : the obstacles are read directly)
+ * @see dj_obstacle_importer_use_snapshot
  */
-static bool dynamic_obstacles_enabled = true;
+static __thread dj_obstacle_importer_state_t *thread_snapshot = NULL;
+#endif
 
 /* ********************************************** Private functions definitions ****************************************** */
 
@@ -133,8 +129,9 @@ static void dj_importer_static_init(
         // Oversize the obstacle
         dj_oversize_obstacle(polygon, mode, margin);
     // Add the obstacle to the list
-    dj_obstacle_static_t *new_obstacle = static_obstacles_list_add(&static_obstacles, NULL);
+    dj_obstacle_static_t *new_obstacle = static_obstacles_list_add(&obstacles.m_static_obstacles, NULL);
     dj_control_non_null(new_obstacle, ) dj_obstacle_static_init(new_obstacle, polygon, id, is_enabled);
+    obstacles.m_epoch++;
     dj_debug_printf("Obstacle %d added, points : ", id);
     for (uint8_t i = 0; i < polygon->nb_points; i++)
     {
@@ -156,7 +153,7 @@ static void dj_importer_dynamic_init(dj_dynamic_obstacle_id_e id, dj_polygon_t *
     dj_control_non_null(polygon, )
         // Oversize the obstacle
         dj_oversize_obstacle(polygon, DJ_OBSRTACLE_OVERSIZE_MODE_1_POINT, 0);
-    dj_obstacle_dynamic_t *new_obstacle = dynamic_obstacles_list_add(&dynamic_obstacles, NULL);
+    dj_obstacle_dynamic_t *new_obstacle = dynamic_obstacles_list_add(&obstacles.m_dynamic_obstacles, NULL);
     dj_control_non_null(new_obstacle, ) dj_obstacle_dynamic_init(new_obstacle,
                                                                  polygon,
                                                                  &(GEOMETRY_point_t){-10000, -10000},
@@ -164,19 +161,21 @@ static void dj_importer_dynamic_init(dj_dynamic_obstacle_id_e id, dj_polygon_t *
                                                                  &(GEOMETRY_vector_t){0, 0},
                                                                  id,
                                                                  is_enabled);
+    obstacles.m_epoch++;
 }
 
 /**
  * @brief Function to get the index of a static obstacle in the list
  *
+ * @param state Obstacles in which the obstacle is searched
  * @param id ID of the obstacle
  * @return Index of the obstacle in the list
  */
-static uint32_t dj_importer_get_static_obstacle_index(dj_static_obstacle_id_e id)
+static uint32_t dj_importer_get_static_obstacle_index(dj_obstacle_importer_state_t *state, dj_static_obstacle_id_e id)
 {
-    for (uint32_t i = 0; i < static_obstacles_list_size(&static_obstacles); i++)
+    for (uint32_t i = 0; i < static_obstacles_list_size(&state->m_static_obstacles); i++)
     {
-        dj_obstacle_static_t *obstacle = static_obstacles_list_get(&static_obstacles, i);
+        dj_obstacle_static_t *obstacle = static_obstacles_list_get(&state->m_static_obstacles, i);
         dj_control_non_null(obstacle, -1);
         if (obstacle->m_id == id)
         {
@@ -189,14 +188,15 @@ static uint32_t dj_importer_get_static_obstacle_index(dj_static_obstacle_id_e id
 /**
  * @brief Function to get the index of a dynamic obstacle in the list
  *
+ * @param state Obstacles in which the obstacle is searched
  * @param id ID of the obstacle
  * @return Index of the obstacle in the list
  */
-static uint32_t dj_importer_get_dynamic_obstacle_index(dj_dynamic_obstacle_id_e id)
+static uint32_t dj_importer_get_dynamic_obstacle_index(dj_obstacle_importer_state_t *state, dj_dynamic_obstacle_id_e id)
 {
-    for (uint32_t i = 0; i < dynamic_obstacles_list_size(&dynamic_obstacles); i++)
+    for (uint32_t i = 0; i < dynamic_obstacles_list_size(&state->m_dynamic_obstacles); i++)
     {
-        dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(&dynamic_obstacles, i);
+        dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(&state->m_dynamic_obstacles, i);
         dj_control_non_null(obstacle, -1);
         if (obstacle->m_id == id)
         {
@@ -206,13 +206,34 @@ static uint32_t dj_importer_get_dynamic_obstacle_index(dj_dynamic_obstacle_id_e
     return -1;
 }
 
+/**
+ * @brief Function to get the obstacles read by the current thread
+ *
+ * @return dj_obstacle_importer_state_t* The snapshot of the thread if any (see dj_obstacle_importer_use_snapshot),
+ *         the obstacles otherwise
+ */
+static dj_obstacle_importer_state_t *dj_importer_get_read_state(void)
+{
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_PLANNER_SERVICE_THREAD
+    if (thread_snapshot != NULL)
+    {
+        return thread_snapshot;
+    }
+#endif
+    return &obstacles;
+}
+
 /* *********************************************** Public functions declarations ***************************************** */
 
 void dj_obstacle_importer_init()
 {
-    dynamic_obstacles_enabled = true;
-    static_obstacles_list_init(&static_obstacles);
-    dynamic_obstacles_list_init(&dynamic_obstacles);
+    obstacles.m_dynamic_obstacles_enabled = true;
+    obstacles.m_epoch++;
+    static_obstacles_list_init(&obstacles.m_static_obstacles);
+    dynamic_obstacles_list_init(&obstacles.m_dynamic_obstacles);
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    dj_dynamic_obstacle_pool_init(&obstacles.m_dynamic_obstacle_pool);
+#endif
 }
 
 void dj_obstacle_import_default_obstacles()
@@ -410,17 +431,20 @@ void dj_obstacle_import_default_obstacles()
 void dj_obstacle_importer_deinit()
 {
     // Deinitialize the obstacles
-    for (uint32_t i = 0; i < static_obstacles_list_size(&static_obstacles); i++)
+    for (uint32_t i = 0; i < static_obstacles_list_size(&obstacles.m_static_obstacles); i++)
     {
-        dj_obstacle_static_t *obstacle = static_obstacles_list_get(&static_obstacles, i);
+        dj_obstacle_static_t *obstacle = static_obstacles_list_get(&obstacles.m_static_obstacles, i);
         dj_control_non_null(obstacle, ) dj_obstacle_static_deinit(obstacle);
     }
-    for (uint32_t i = 0; i < dynamic_obstacles_list_size(&dynamic_obstacles); i++)
+    for (uint32_t i = 0; i < dynamic_obstacles_list_size(&obstacles.m_dynamic_obstacles); i++)
     {
-        dj_obstacle_dynamic_t *obstacle
-            = dynamic_obstacles_list_get(&dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(i));
+        dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(&obstacles.m_dynamic_obstacles,
+                                                                     dj_importer_get_dynamic_obstacle_index(&obstacles, i));
         dj_control_non_null(obstacle, ) dj_obstacle_dynamic_deinit(obstacle);
     }
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    dj_dynamic_obstacle_pool_deinit(&obstacles.m_dynamic_obstacle_pool);
+#endif
 }
 
 dj_static_obstacle_id_e dj_obstacle_importer_import_static_obstacle(dj_polygon_t *shape,
@@ -462,9 +486,10 @@ void dj_obstacle_importer_refresh_dynamic_obstacle(dj_dynamic_obstacle_id_e obst
         dj_error_printf("Invalid obstacle id");
         return;
     }
-    dj_obstacle_dynamic_t *obstacle
-        = dynamic_obstacles_list_get(&dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(obstacle_id));
+    dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(
+        &obstacles.m_dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(&obstacles, obstacle_id));
     dj_control_non_null(obstacle, ) dj_obstacle_dynamic_refresh(obstacle, acceleration, initial_speed, initial_position);
+    obstacles.m_epoch++;
 }
 
 void dj_obstacle_importer_enable_static_obstacle(dj_static_obstacle_id_e obstacle_id, bool enable)
@@ -475,9 +500,10 @@ void dj_obstacle_importer_enable_static_obstacle(dj_static_obstacle_id_e obstacl
         dj_error_printf("Invalid obstacle id");
         return;
     }
-    dj_obstacle_static_t *obstacle
-        = static_obstacles_list_get(&static_obstacles, dj_importer_get_static_obstacle_index(obstacle_id));
+    dj_obstacle_static_t *obstacle = static_obstacles_list_get(
+        &obstacles.m_static_obstacles, dj_importer_get_static_obstacle_index(&obstacles, obstacle_id));
     dj_control_non_null(obstacle, ) obstacle->m_is_enabled = enable;
+    obstacles.m_epoch++;
 }
 
 void dj_obstacle_importer_enable_dynamic_obstacle(dj_dynamic_obstacle_id_e obstacle_id, bool enable)
@@ -488,9 +514,10 @@ void dj_obstacle_importer_enable_dynamic_obstacle(dj_dynamic_obstacle_id_e obsta
         dj_error_printf("Invalid obstacle id");
         return;
     }
-    dj_obstacle_dynamic_t *obstacle
-        = dynamic_obstacles_list_get(&dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(obstacle_id));
+    dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(
+        &obstacles.m_dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(&obstacles, obstacle_id));
     dj_control_non_null(obstacle, ) obstacle->m_is_enabled = enable;
+    obstacles.m_epoch++;
 }
 
 bool dj_obstacle_importer_static_is_enabled(dj_static_obstacle_id_e obstacle_id)
@@ -501,8 +528,9 @@ bool dj_obstacle_importer_static_is_enabled(dj_static_obstacle_id_e obstacle_id)
         dj_error_printf("Invalid obstacle id");
         return false;
     }
+    dj_obstacle_importer_state_t *state = dj_importer_get_read_state();
     dj_obstacle_static_t *obstacle
-        = static_obstacles_list_get(&static_obstacles, dj_importer_get_static_obstacle_index(obstacle_id));
+        = static_obstacles_list_get(&state->m_static_obstacles, dj_importer_get_static_obstacle_index(state, obstacle_id));
     dj_control_non_null(obstacle, false) return obstacle->m_is_enabled;
 }
 
@@ -514,8 +542,9 @@ bool dj_obstacle_importer_dynamic_is_enabled(dj_dynamic_obstacle_id_e obstacle_i
         dj_error_printf("Invalid obstacle id");
         return false;
     }
-    dj_obstacle_dynamic_t *obstacle
-        = dynamic_obstacles_list_get(&dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(obstacle_id));
+    dj_obstacle_importer_state_t *state = dj_importer_get_read_state();
+    dj_obstacle_dynamic_t *obstacle = dynamic_obstacles_list_get(&state->m_dynamic_obstacles,
+                                                                 dj_importer_get_dynamic_obstacle_index(state, obstacle_id));
     dj_control_non_null(obstacle, false) return obstacle->m_is_enabled;
 }
 
@@ -527,8 +556,9 @@ dj_obstacle_static_t *dj_obstacle_importer_get_static_obstacle(dj_static_obstacl
         dj_error_printf("Invalid obstacle id");
         return NULL;
     }
+    dj_obstacle_importer_state_t *state = dj_importer_get_read_state();
     dj_obstacle_static_t *obstacle
-        = static_obstacles_list_get(&static_obstacles, dj_importer_get_static_obstacle_index(obstacle_id));
+        = static_obstacles_list_get(&state->m_static_obstacles, dj_importer_get_static_obstacle_index(state, obstacle_id));
     dj_control_non_null(obstacle, NULL) return obstacle;
 }
 
@@ -540,17 +570,102 @@ dj_obstacle_dynamic_t *dj_obstacle_importer_get_dynamic_obstacle(dj_dynamic_obst
         dj_error_printf("Invalid obstacle id");
         return NULL;
     }
-    if (!dynamic_obstacles_enabled)
+    dj_obstacle_importer_state_t *state = dj_importer_get_read_state();
+    if (!state->m_dynamic_obstacles_enabled)
     {
         return NULL;
     }
-    return dynamic_obstacles_list_get(&dynamic_obstacles, dj_importer_get_dynamic_obstacle_index(obstacle_id));
+    return dynamic_obstacles_list_get(&state->m_dynamic_obstacles,
+                                      dj_importer_get_dynamic_obstacle_index(state, obstacle_id));
 }
 
 void dj_obstacle_importer_enable_dynamic_obstacles(bool enable)
 {
     // Enable or disable all the dynamic obstacles
-    dynamic_obstacles_enabled = enable;
+    obstacles.m_dynamic_obstacles_enabled = enable;
+    obstacles.m_epoch++;
+}
+
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+dj_dynamic_obstacle_handle_t dj_obstacle_importer_add_pooled_dynamic_obstacle(dj_polygon_t *initial_shape,
+                                                                              bool is_enabled)
+{
+    dj_control_non_null(initial_shape, DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE);
+    // Oversize the obstacle the same way as the imported dynamic obstacles
+    dj_oversize_obstacle(initial_shape, DJ_OBSRTACLE_OVERSIZE_MODE_1_POINT, 0);
+    obstacles.m_epoch++;
+    return dj_dynamic_obstacle_pool_alloc(&obstacles.m_dynamic_obstacle_pool, initial_shape, is_enabled);
+}
+
+void dj_obstacle_importer_remove_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle)
+{
+    dj_dynamic_obstacle_pool_free(&obstacles.m_dynamic_obstacle_pool, handle);
+    obstacles.m_epoch++;
+}
+
+void dj_obstacle_importer_refresh_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle,
+                                                          GEOMETRY_vector_t *acceleration,
+                                                          GEOMETRY_vector_t *initial_speed,
+                                                          GEOMETRY_point_t *initial_position)
+{
+    dj_obstacle_dynamic_t *obstacle = dj_dynamic_obstacle_pool_get(&obstacles.m_dynamic_obstacle_pool, handle);
+    if (obstacle == NULL)
+    {
+        dj_error_printf("Invalid dynamic obstacle handle\n");
+        return;
+    }
+    dj_obstacle_dynamic_refresh(obstacle, acceleration, initial_speed, initial_position);
+    obstacles.m_epoch++;
+}
+
+void dj_obstacle_importer_enable_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle, bool enable)
+{
+    dj_obstacle_dynamic_t *obstacle = dj_dynamic_obstacle_pool_get(&obstacles.m_dynamic_obstacle_pool, handle);
+    if (obstacle == NULL)
+    {
+        dj_error_printf("Invalid dynamic obstacle handle\n");
+        return;
+    }
+    obstacle->m_is_enabled = enable;
+    obstacles.m_epoch++;
+}
+
+uint16_t dj_obstacle_importer_get_pooled_dynamic_obstacle_count()
+{
+    return dj_dynamic_obstacle_pool_get_live_count(&dj_importer_get_read_state()->m_dynamic_obstacle_pool);
+}
+
+dj_obstacle_dynamic_t *dj_obstacle_importer_get_pooled_dynamic_obstacle(uint16_t live_index)
+{
+    dj_obstacle_importer_state_t *state = dj_importer_get_read_state();
+    if (!state->m_dynamic_obstacles_enabled)
+    {
+        return NULL;
+    }
+    return dj_dynamic_obstacle_pool_get_live(&state->m_dynamic_obstacle_pool, live_index);
+}
+#endif
+
+uint32_t dj_obstacle_importer_get_epoch()
+{
+    return dj_importer_get_read_state()->m_epoch;
+}
+
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_PLANNER_SERVICE_THREAD
+void dj_obstacle_importer_take_snapshot(dj_obstacle_importer_state_t *snapshot)
+{
+    dj_control_non_null(snapshot, );
+    // The obstacles are copied only if they have been modified since the previous snapshot
+    if (snapshot->m_epoch != obstacles.m_epoch)
+    {
+        *snapshot = obstacles;
+    }
+}
+
+void dj_obstacle_importer_use_snapshot(dj_obstacle_importer_state_t *snapshot)
+{
+    thread_snapshot = snapshot;
 }
+#endif
 
 /* ******************************************* Public callback functions declarations ************************************ */
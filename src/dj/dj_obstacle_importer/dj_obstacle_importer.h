@@ -11,11 +11,14 @@
 
 /* ******************************************************* Includes ****************************************************** */
 
+#include "../dj_config.h"
 #include "../dj_dependencies/dj_dependencies.h"
 #include "../dj_obstacle/dj_obstacle_dynamic.h"
+#include "../dj_obstacle/dj_obstacle_manager.h"
 #include "../dj_obstacle/dj_obstacle_static.h"
 #include "../dj_obstacle/dj_oversize_obstacle.h"
 #include "../dj_obstacle/dj_polygon.h"
+#include "dj_dynamic_obstacle_pool.h"
 #include "dj_obstacle_id.h"
 
 #include <stdbool.h>
@@ -24,6 +27,42 @@
 
 /* ************************************************** Public types definition ******************************************** */
 
+MAGIC_ARRAY_TYPEDEF(dynamic_obstacles_list, dj_obstacle_dynamic_t, 5);
+
+/**
+ * @brief State of the imported obstacles
+ * @note The state can be copied, so a thread can read a snapshot while the obstacles are modified
+ * @see dj_obstacle_importer_take_snapshot
+ */
+typedef struct
+{
+    /**
+     * @brief List of static obstacles
+     */
+    static_obstacles_list_t m_static_obstacles;
+    /**
+     * @brief List of dynamic obstacles
+     */
+    dynamic_obstacles_list_t m_dynamic_obstacles;
+    /**
+     * @brief Enable or disable the dynamic obstacles
+     * @see dj_obstacle_importer_enable_dynamic_obstacles
+     */
+    bool m_dynamic_obstacles_enabled;
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    /**
+     * @brief Pool of the dynamic obstacles allocated at runtime
+     * @see dj_obstacle_importer_add_pooled_dynamic_obstacle
+     */
+    dj_dynamic_obstacle_pool_t m_dynamic_obstacle_pool;
+#endif
+    /**
+     * @brief Epoch of the obstacles, incremented by each modification
+     * @see dj_obstacle_importer_get_epoch
+     */
+    uint32_t m_epoch;
+} dj_obstacle_importer_state_t;
+
 /* *********************************************** Public functions declarations ***************************************** */
 
 /**
@@ -156,6 +195,99 @@ dj_obstacle_dynamic_t *dj_obstacle_importer_get_dynamic_obstacle(dj_dynamic_obst
  */
 void dj_obstacle_importer_enable_dynamic_obstacles(bool enable);
 
+#if DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Function to add a dynamic obstacle in the dynamic obstacle pool
+ * @note Unlike dj_obstacle_importer_import_dynamic_obstacle, the obstacle can be removed,
+ *  so this function is made to follow tracked objects (opponent robots, PAMIs, game elements...)
+ * @note The shape must be centralized as best as possible on the origin
+ * @note After the import, the obstacle will not have any position, speed or acceleration, so you must refresh it
+ * @see dj_obstacle_importer_refresh_pooled_dynamic_obstacle
+ *
+ * @param initial_shape Shape of the obstacle
+ * @param is_enabled true if the obstacle is enabled, false otherwise
+ * @return dj_dynamic_obstacle_handle_t Handle of the obstacle, DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE if the pool is full
+ */
+dj_dynamic_obstacle_handle_t dj_obstacle_importer_add_pooled_dynamic_obstacle(dj_polygon_t *initial_shape,
+                                                                              bool is_enabled);
+
+/**
+ * @brief Function to remove a dynamic obstacle from the dynamic obstacle pool
+ * @note The handle must not be used anymore after this call
+ *
+ * @param handle Handle of the obstacle to remove
+ */
+void dj_obstacle_importer_remove_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle);
+
+/**
+ * @brief Function to refresh the position of a dynamic obstacle of the pool
+ *
+ * @param handle Handle of the obstacle to refresh
+ * @param acceleration Acceleration of the obstacle (mm/s^2) (on x and y axis)
+ * @param initial_speed Initial speed of the obstacle (mm/s) (on x and y axis)
+ * @param initial_position Initial position of the obstacle (mm) (on x and y axis)
+ *
+ * @note acceleration and initial_speed should be colinear
+ */
+void dj_obstacle_importer_refresh_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle,
+                                                          GEOMETRY_vector_t *acceleration,
+                                                          GEOMETRY_vector_t *initial_speed,
+                                                          GEOMETRY_point_t *initial_position);
+
+/**
+ * @brief Function to enable or disable a dynamic obstacle of the pool
+ *
+ * @param handle Handle of the obstacle to enable or disable
+ * @param enable true to enable the obstacle, false to disable it
+ */
+void dj_obstacle_importer_enable_pooled_dynamic_obstacle(dj_dynamic_obstacle_handle_t handle, bool enable);
+
+/**
+ * @brief Function to get the number of live dynamic obstacles in the pool
+ *
+ * @return uint16_t Number of live dynamic obstacles in the pool
+ */
+uint16_t dj_obstacle_importer_get_pooled_dynamic_obstacle_count();
+
+/**
+ * @brief Function to get a live dynamic obstacle of the pool
+ *
+ * @param live_index Index of the obstacle in [0 ; dj_obstacle_importer_get_pooled_dynamic_obstacle_count[
+ * @return dj_obstacle_dynamic_t* The dynamic obstacle (NULL if dynamic obstacles are disabled)
+ */
+dj_obstacle_dynamic_t *dj_obstacle_importer_get_pooled_dynamic_obstacle(uint16_t live_index);
+#endif
+
+/**
+ * @brief Function to get the epoch of the obstacles
+ * @note The epoch changes with each modification of the obstacles (import, refresh, enabling, pool), so a path
+ *       computed at the same epoch is computed with the same obstacles (see dj_plan_cache.h)
+ *
+ * @return uint32_t Epoch of the obstacles
+ */
+uint32_t dj_obstacle_importer_get_epoch();
+
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_PLANNER_SERVICE_THREAD
+/**
+ * @brief Function to copy the obstacles in a snapshot
+ * @note The obstacles are copied only if they have been modified since the previous snapshot (see
+ *       dj_obstacle_importer_get_epoch)
+ * @warning The obstacles musn't be modified during the copy (see dj_planner_service_lock)
+ *
+ * @param [in,out] snapshot The snapshot
+ */
+void dj_obstacle_importer_take_snapshot(dj_obstacle_importer_state_t *snapshot);
+
+/**
+ * @brief Function to read the obstacles of a snapshot in the calling thread
+ * @note The getters of the importer return the obstacles of the snapshot to the calling thread only, the other
+ *       threads still read and modify the obstacles directly
+ *
+ * @param [in] snapshot The snapshot (see dj_obstacle_importer_take_snapshot), NULL to read the obstacles directly
+ */
+void dj_obstacle_importer_use_snapshot(dj_obstacle_importer_state_t *snapshot);
+#endif
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
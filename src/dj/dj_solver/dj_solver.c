@@ -19,46 +19,244 @@
 
 /* ********************************************* Private functions declarations ****************************************** */
 
+static void dijkstra_init(void *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace);
+static void dijkstra_deinit(void *solver);
+static void dijkstra_set_epsilon(void *solver, float epsilon);
+static void dijkstra_set_heuristic(void *solver, dj_solver_heuristic_t heuristic);
+static void dijkstra_solve(void *solver, dj_viewer_status_t *start_status);
+static void dijkstra_solve_before(void *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+static void dijkstra_begin(void *solver, dj_viewer_status_t *start_status);
+static bool dijkstra_step(void *solver, uint32_t deadline_us);
+static void dijkstra_get_solution(void *solver, dj_graph_path_t *solution);
+static float dijkstra_get_bound(void *solver);
+static void astar_init(void *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace);
+static void astar_deinit(void *solver);
+static void astar_set_epsilon(void *solver, float epsilon);
+static void astar_set_heuristic(void *solver, dj_solver_heuristic_t heuristic);
+static void astar_solve(void *solver, dj_viewer_status_t *start_status);
+static void astar_solve_before(void *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+static void astar_begin(void *solver, dj_viewer_status_t *start_status);
+static bool astar_step(void *solver, uint32_t deadline_us);
+static void astar_get_solution(void *solver, dj_graph_path_t *solution);
+static float astar_get_bound(void *solver);
+
 /* ************************************************** Private variables ************************************************** */
 
+static const dj_solver_vtable_t dijkstra_vtable = {
+    .m_name = "Dijkstra",
+    .m_init = dijkstra_init,
+    .m_deinit = dijkstra_deinit,
+    .m_set_epsilon = dijkstra_set_epsilon,
+    .m_set_heuristic = dijkstra_set_heuristic,
+    .m_solve = dijkstra_solve,
+    .m_solve_before = dijkstra_solve_before,
+    .m_begin = dijkstra_begin,
+    .m_step = dijkstra_step,
+    .m_get_solution = dijkstra_get_solution,
+    .m_get_bound = dijkstra_get_bound,
+};
+
+static const dj_solver_vtable_t astar_vtable = {
+    .m_name = "A*",
+    .m_init = astar_init,
+    .m_deinit = astar_deinit,
+    .m_set_epsilon = astar_set_epsilon,
+    .m_set_heuristic = astar_set_heuristic,
+    .m_solve = astar_solve,
+    .m_solve_before = astar_solve_before,
+    .m_begin = astar_begin,
+    .m_step = astar_step,
+    .m_get_solution = astar_get_solution,
+    .m_get_bound = astar_get_bound,
+};
+
 /* ********************************************** Private functions definitions ****************************************** */
 
+static void dijkstra_init(void *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace)
+{
+    dj_solver_dijkstra_init((dj_solver_dijkstra_t *)solver, graph_builder, workspace);
+}
+
+static void dijkstra_deinit(void *solver)
+{
+    dj_solver_dijkstra_deinit((dj_solver_dijkstra_t *)solver);
+}
+
+static void dijkstra_set_epsilon(void *solver, float epsilon)
+{
+    // The Dijkstra solver always returns the fastest path
+    (void)solver;
+    (void)epsilon;
+}
+
+static void dijkstra_set_heuristic(void *solver, dj_solver_heuristic_t heuristic)
+{
+    // The Dijkstra solver has no heuristic
+    (void)solver;
+    (void)heuristic;
+}
+
+static void dijkstra_solve(void *solver, dj_viewer_status_t *start_status)
+{
+    dj_solver_dijkstra_solve((dj_solver_dijkstra_t *)solver, start_status);
+}
+
+static void dijkstra_solve_before(void *solver, dj_viewer_status_t *start_status, uint32_t deadline_us)
+{
+    dj_solver_dijkstra_solve_before((dj_solver_dijkstra_t *)solver, start_status, deadline_us);
+}
+
+static void dijkstra_begin(void *solver, dj_viewer_status_t *start_status)
+{
+    dj_solver_dijkstra_begin((dj_solver_dijkstra_t *)solver, start_status);
+}
+
+static bool dijkstra_step(void *solver, uint32_t deadline_us)
+{
+    return dj_solver_dijkstra_step((dj_solver_dijkstra_t *)solver, deadline_us);
+}
+
+static void dijkstra_get_solution(void *solver, dj_graph_path_t *solution)
+{
+    dj_solver_dijkstra_get_solution((dj_solver_dijkstra_t *)solver, solution);
+}
+
+static float dijkstra_get_bound(void *solver)
+{
+    // The solution is the fastest path, unless the solve has been stopped by the deadline before the end
+    return ((dj_solver_dijkstra_t *)solver)->is_partial ? 0.0f : 1.0f;
+}
+
+static void astar_init(void *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace)
+{
+    dj_solver_astar_init((dj_solver_astar_t *)solver, graph_builder, workspace);
+}
+
+static void astar_deinit(void *solver)
+{
+    dj_solver_astar_deinit((dj_solver_astar_t *)solver);
+}
+
+static void astar_set_epsilon(void *solver, float epsilon)
+{
+    dj_solver_astar_set_epsilon((dj_solver_astar_t *)solver, epsilon);
+}
+
+static void astar_set_heuristic(void *solver, dj_solver_heuristic_t heuristic)
+{
+    if (heuristic != NULL)
+    {
+        ((dj_solver_astar_t *)solver)->heuristic = heuristic;
+    }
+}
+
+static void astar_solve(void *solver, dj_viewer_status_t *start_status)
+{
+    dj_solver_astar_solve((dj_solver_astar_t *)solver, start_status);
+}
+
+static void astar_solve_before(void *solver, dj_viewer_status_t *start_status, uint32_t deadline_us)
+{
+    dj_solver_astar_solve_before((dj_solver_astar_t *)solver, start_status, deadline_us);
+}
+
+static void astar_begin(void *solver, dj_viewer_status_t *start_status)
+{
+    dj_solver_astar_begin((dj_solver_astar_t *)solver, start_status);
+}
+
+static bool astar_step(void *solver, uint32_t deadline_us)
+{
+    return dj_solver_astar_step((dj_solver_astar_t *)solver, deadline_us);
+}
+
+static void astar_get_solution(void *solver, dj_graph_path_t *solution)
+{
+    dj_solver_astar_get_solution((dj_solver_astar_t *)solver, solution);
+}
+
+static float astar_get_bound(void *solver)
+{
+    return dj_solver_astar_get_bound((dj_solver_astar_t *)solver);
+}
+
 /* *********************************************** Public functions declarations ***************************************** */
 
-void dj_solver_init(dj_solver_t *solver, dj_graph_builder_t *graph_builder)
+const dj_solver_vtable_t *dj_solver_get_vtable(uint8_t solver_type)
+{
+    switch (solver_type)
+    {
+    case DJ_SOLVER_TYPE_DIJKSTRA:
+        return &dijkstra_vtable;
+    case DJ_SOLVER_TYPE_ASTAR:
+        return &astar_vtable;
+    default:
+        return dj_solver_get_vtable(DJ_SOLVER_TYPE);
+    }
+}
+
+void dj_solver_init(dj_solver_t *solver,
+                    const dj_solver_vtable_t *vtable,
+                    dj_graph_builder_t *graph_builder,
+                    dj_solver_workspace_t *workspace)
 {
-#if DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA
-    dj_solver_dijkstra_init((dj_solver_dijkstra_t *)solver, graph_builder);
-#elif DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR
-    dj_solver_astar_init((dj_solver_astar_t *)solver, graph_builder);
-#endif
+    dj_control_non_null(solver, );
+    solver->m_vtable = (vtable != NULL) ? vtable : dj_solver_get_vtable(DJ_SOLVER_TYPE);
+    solver->m_vtable->m_init(&solver->m_instance, graph_builder, workspace);
 }
 
 void dj_solver_deinit(dj_solver_t *solver)
 {
-#if DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA
-    dj_solver_dijkstra_deinit((dj_solver_dijkstra_t *)solver);
-#elif DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR
-    dj_solver_astar_deinit((dj_solver_astar_t *)solver);
-#endif
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_deinit(&solver->m_instance);
+}
+
+void dj_solver_set_epsilon(dj_solver_t *solver, float epsilon)
+{
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_set_epsilon(&solver->m_instance, epsilon);
+}
+
+void dj_solver_set_heuristic(dj_solver_t *solver, dj_solver_heuristic_t heuristic)
+{
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_set_heuristic(&solver->m_instance, heuristic);
 }
 
 void dj_solver_solve(dj_solver_t *solver, dj_viewer_status_t *start_status)
 {
-#if DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA
-    dj_solver_dijkstra_solve((dj_solver_dijkstra_t *)solver, start_status);
-#elif DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR
-    dj_solver_astar_solve((dj_solver_astar_t *)solver, start_status);
-#endif
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_solve(&solver->m_instance, start_status);
+}
+
+void dj_solver_solve_before(dj_solver_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_solve_before(&solver->m_instance, start_status, deadline_us);
+}
+
+void dj_solver_begin(dj_solver_t *solver, dj_viewer_status_t *start_status)
+{
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_begin(&solver->m_instance, start_status);
+}
+
+bool dj_solver_step(dj_solver_t *solver, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, true);
+    return solver->m_vtable->m_step(&solver->m_instance, deadline_us);
 }
 
 void dj_solver_get_solution(dj_solver_t *solver, dj_graph_path_t *solution)
 {
-#if DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA
-    dj_solver_dijkstra_get_solution((dj_solver_dijkstra_t *)solver, solution);
-#elif DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR
-    dj_solver_astar_get_solution((dj_solver_astar_t *)solver, solution);
-#endif
+    dj_control_non_null(solver, );
+    solver->m_vtable->m_get_solution(&solver->m_instance, solution);
+}
+
+float dj_solver_get_bound(dj_solver_t *solver)
+{
+    dj_control_non_null(solver, 1.0f);
+    return solver->m_vtable->m_get_bound(&solver->m_instance);
 }
 
 /* ******************************************* Public callback functions declarations ************************************ */
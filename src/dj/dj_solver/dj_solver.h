@@ -14,36 +14,85 @@
 #include "../dj_graph/dj_graph_path.h"
 #include "../dj_graph_builder/dj_graph_builder.h"
 
+#include "dj_solver_astar/dj_solver_astar.h"
+#include "dj_solver_dijkstra/dj_solver_dijkstra.h"
+
+/* ***************************************************** Public macros *************************************************** */
+
 #define DJ_SOLVER_TYPE_DIJKSTRA 0
 #define DJ_SOLVER_TYPE_ASTAR 1
 
+/**
+ * @brief Solver used when no solver is given
+ * @note Both solvers are always compiled, the solver can be chosen for each query (see dj_planner_config_t)
+ */
 #define DJ_SOLVER_TYPE DJ_SOLVER_TYPE_ASTAR
 
-#if (DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA)
-#include "dj_solver_dijkstra/dj_solver_dijkstra.h"
-#elif (DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR)
-#include "dj_solver_astar/dj_solver_astar.h"
-#endif
-
-/* ***************************************************** Public macros *************************************************** */
-
 /* ************************************************** Public types definition ******************************************** */
 
-#if DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_DIJKSTRA
-typedef dj_solver_dijkstra_t dj_solver_t;
-#elif DJ_SOLVER_TYPE == DJ_SOLVER_TYPE_ASTAR
-typedef dj_solver_astar_t dj_solver_t;
-#endif
+/**
+ * @brief Functions of a solver
+ * @note The solver given to the functions is the instance of the solver (e.g. dj_solver_astar_t)
+ */
+typedef struct
+{
+    /**
+     * @brief Name of the solver (for the logs and the benchmarks)
+     */
+    const char *m_name;
+    void (*m_init)(void *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace);
+    void (*m_deinit)(void *solver);
+    void (*m_set_epsilon)(void *solver, float epsilon);
+    void (*m_set_heuristic)(void *solver, dj_solver_heuristic_t heuristic);
+    void (*m_solve)(void *solver, dj_viewer_status_t *start_status);
+    void (*m_solve_before)(void *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+    void (*m_begin)(void *solver, dj_viewer_status_t *start_status);
+    bool (*m_step)(void *solver, uint32_t deadline_us);
+    void (*m_get_solution)(void *solver, dj_graph_path_t *solution);
+    float (*m_get_bound)(void *solver);
+} dj_solver_vtable_t;
+
+/**
+ * @brief Structure to store a solver of any type
+ */
+typedef struct
+{
+    /**
+     * @brief Functions of the solver
+     */
+    const dj_solver_vtable_t *m_vtable;
+    /**
+     * @brief Instance of the solver (only the one of m_vtable is used)
+     */
+    union
+    {
+        dj_solver_dijkstra_t m_dijkstra;
+        dj_solver_astar_t m_astar;
+    } m_instance;
+} dj_solver_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
 
+/**
+ * @brief Function to get the functions of a solver
+ *
+ * @param solver_type Type of the solver (DJ_SOLVER_TYPE_DIJKSTRA, DJ_SOLVER_TYPE_ASTAR)
+ * @return const dj_solver_vtable_t* Functions of the solver, those of DJ_SOLVER_TYPE if the type is unknown
+ */
+const dj_solver_vtable_t *dj_solver_get_vtable(uint8_t solver_type);
+
 /**
  * @brief Function to initialize a solver
  *
  * @param solver Pointer to the solver to initialize
+ * @param vtable Functions of the solver to use (NULL for the solver of DJ_SOLVER_TYPE)
  * @param graph_builder Pointer to the graph builder to use
+ * @param workspace Pointer to the memory to use during the solves (it musn't be used by another solver at the same time)
  */
-void dj_solver_init(dj_solver_t *solver, dj_graph_builder_t *graph_builder);
+void dj_solver_init(dj_solver_t *solver,
+                    const dj_solver_vtable_t *vtable,
+                    dj_graph_builder_t *graph_builder,
+                    dj_solver_workspace_t *workspace);
 
 /**
  * @brief Function to deinitialize a solver
@@ -52,6 +101,18 @@ void dj_solver_init(dj_solver_t *solver, dj_graph_builder_t *graph_builder);
  */
 void dj_solver_deinit(dj_solver_t *solver);
 
+/**
+ * @brief Function to set the tolerance of the solution : its duration is at most (1 + epsilon) times the fastest one
+ * @note The Dijkstra solver always returns the fastest path
+ * @see DJ_SOLVER_ASTAR_EPSILON
+ *
+ * @param solver Pointer to the solver
+ * @param epsilon Tolerance (0 for the fastest path)
+ */
+void dj_solver_set_epsilon(dj_solver_t *solver, float epsilon);
+
+void dj_solver_set_heuristic(dj_solver_t *solver, dj_solver_heuristic_t heuristic);
+
 /**
  * @brief Function to solve the graph
  *
@@ -59,6 +120,37 @@ void dj_solver_deinit(dj_solver_t *solver);
  */
 void dj_solver_solve(dj_solver_t *solver, dj_viewer_status_t *start_status);
 
+/**
+ * @brief Function to solve the graph before a deadline, the best path found in time is kept
+ * @note If no path is found in time, the solution is the best partial path, it doesn't reach the end and its bound
+ *       is 0 (see dj_solver_common_get_closest_node)
+ *
+ * @param solver Pointer to the solver to solve
+ * @param start_status Start status of the path
+ * @param deadline_us Time at which the solving must be stopped (see dj_dep_get_time_us)
+ */
+void dj_solver_solve_before(dj_solver_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+
+/**
+ * @brief Function to start a solve done by slices (see dj_solver_step)
+ * @note The solve gives the same solution as dj_solver_solve
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the path, it must stay valid until the end of the solve
+ */
+void dj_solver_begin(dj_solver_t *solver, dj_viewer_status_t *start_status);
+
+/**
+ * @brief Function to go on with the solve started by dj_solver_begin until a deadline
+ * @note At least one search node is explored by each call, so the solve always progresses
+ * @note The graph builder and the workspace musn't be used by anything else between the calls
+ *
+ * @param solver Pointer to the solver
+ * @param deadline_us Time at which the slice must be stopped (see dj_dep_get_time_us)
+ * @return bool True if the solve is finished (the solution can be read), false if it must go on
+ */
+bool dj_solver_step(dj_solver_t *solver, uint32_t deadline_us);
+
 /**
  * @brief Function to get the solution
  *
@@ -67,6 +159,14 @@ void dj_solver_solve(dj_solver_t *solver, dj_viewer_status_t *start_status);
  */
 void dj_solver_get_solution(dj_solver_t *solver, dj_graph_path_t *solution);
 
+/**
+ * @brief Function to get the bound of the ratio between the duration of the solution and the fastest path
+ *
+ * @param solver Pointer to the solver
+ * @return float Bound of the ratio (1 : optimal solution, 0 : partial path, see dj_solver_solve_before)
+ */
+float dj_solver_get_bound(dj_solver_t *solver);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
@@ -28,25 +28,292 @@
 
 /* ********************************************* Private functions declarations ****************************************** */
 
+static void start_search(dj_solver_astar_t *solver, dj_viewer_status_t *start_status, float weight, time32_t cost_limit);
+static int32_t resume_search(dj_solver_astar_t *solver,
+                             bool has_deadline,
+                             uint32_t deadline_us,
+                             uint32_t min_expansions,
+                             bool *deadline_reached);
+static int32_t search_path(dj_solver_astar_t *solver,
+                           dj_viewer_status_t *start_status,
+                           float weight,
+                           time32_t cost_limit,
+                           bool has_deadline,
+                           uint32_t deadline_us,
+                           bool *deadline_reached);
+static bool resume_solve(dj_solver_astar_t *solver, bool has_deadline, uint32_t deadline_us);
+static float get_bound(dj_solver_search_t *search, time32_t best_duration, int32_t goal_index, bool deadline_reached);
+static uint32_t get_shared_length(dj_graph_path_t *path, dj_graph_path_t *other_path, uint32_t *length);
+static bool is_distinct_path(dj_graph_path_t *path, dj_graph_path_t *paths, uint32_t nb_paths);
+
 /* ************************************************** Private variables ************************************************** */
 
+
+/* ********************************************** Private functions definitions ****************************************** */
+
 /**
- * @brief list of path generated during the dijkstra algorithm
- * @note This array is global to avoid stack overflow
+ * @brief Function to start a search of the fastest path to the end of the graph with a weighted A*
+ * @note The search is done by resume_search
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the search
+ * @param weight Weight of the heuristic (1 : the path found is the fastest one)
+ * @param cost_limit Only the paths faster than this duration are searched (UINT32_MAX for no limit)
  */
-static path_list_t path_list DJ_DEP_HEAP_VARS_SUFFIX;
+static void start_search(dj_solver_astar_t *solver, dj_viewer_status_t *start_status, float weight, time32_t cost_limit)
+{
+    GEOMETRY_point_t goal_position = solver->graph_builder->m_graph.end->m_pos;
+    solver->current_index = dj_solver_common_init_nodes(&solver->workspace->m_search,
+                                                        start_status,
+                                                        solver->heuristic,
+                                                        &solver->workspace->m_heuristic_data,
+                                                        &goal_position,
+                                                        weight,
+                                                        cost_limit);
+}
 
-/* ********************************************** Private functions definitions ****************************************** */
+/**
+ * @brief Function to go on with the search started by start_search
+ * @note The search nodes stay in the search of the workspace, so the path of the result can be built from it
+ * @note If the search is stopped by the deadline, it can be resumed by another call
+ *
+ * @param solver Pointer to the solver
+ * @param has_deadline True if the search must be stopped at the deadline
+ * @param deadline_us Deadline of the search (see dj_dep_get_time_us)
+ * @param min_expansions Number of expansions done even if the deadline is reached
+ * @param [out] deadline_reached True if the search has been stopped by the deadline
+ * @return int32_t Index of the search node which reaches the end, -1 if no path has been found
+ */
+static int32_t resume_search(dj_solver_astar_t *solver,
+                             bool has_deadline,
+                             uint32_t deadline_us,
+                             uint32_t min_expansions,
+                             bool *deadline_reached)
+{
+    *deadline_reached = false;
+
+    dj_solver_search_t *search = &solver->workspace->m_search;
+    GEOMETRY_point_t goal_position = solver->graph_builder->m_graph.end->m_pos;
+    uint32_t nb_expansions = 0;
+
+    while (solver->current_index != -1)
+    {
+        dj_solver_search_node_t *current_node = search_node_list_get(&search->m_nodes, solver->current_index);
+        dj_control_non_null(current_node, -1);
+
+        // The search stops on the first node which reaches the end
+        if (current_node->m_position.x == goal_position.x && current_node->m_position.y == goal_position.y)
+        {
+            break;
+        }
+
+        // Check the deadline before each expansion
+        if (has_deadline && nb_expansions >= min_expansions && dj_solver_common_is_deadline_reached(deadline_us))
+        {
+            *deadline_reached = true;
+            return -1;
+        }
+
+        dj_solver_common_expand_node(search, solver->current_index, solver->graph_builder);
+        nb_expansions++;
+
+        solver->current_index = dj_solver_common_find_next_node(search);
+    }
+
+    // Print all the search nodes generated
+#if DJ_ENABLE_DEBUG_LOGS
+    dj_debug_printf("Genrated search nodes:\n");
+    for (int i = 0; i < search_node_list_size(&search->m_nodes); i++)
+    {
+        dj_solver_search_node_t *search_node = search_node_list_get(&search->m_nodes, i);
+        dj_debug_printf("Node %d: (%d ms) (%d, %d) parent %d\n",
+                        i,
+                        (int)search_node->m_evaluation.m_duration,
+                        search_node->m_position.x,
+                        search_node->m_position.y,
+                        (int)search_node->m_parent_index);
+    }
+#endif
+
+    return solver->current_index;
+}
+
+/**
+ * @brief Function to search the fastest path to the end of the graph with a weighted A*
+ * @see start_search
+ * @see resume_search
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the search
+ * @param weight Weight of the heuristic (1 : the path found is the fastest one)
+ * @param cost_limit Only the paths faster than this duration are searched (UINT32_MAX for no limit)
+ * @param has_deadline True if the search must be stopped at the deadline
+ * @param deadline_us Deadline of the search (see dj_dep_get_time_us)
+ * @param [out] deadline_reached True if the search has been stopped by the deadline
+ * @return int32_t Index of the search node which reaches the end, -1 if no path has been found
+ */
+static int32_t search_path(dj_solver_astar_t *solver,
+                           dj_viewer_status_t *start_status,
+                           float weight,
+                           time32_t cost_limit,
+                           bool has_deadline,
+                           uint32_t deadline_us,
+                           bool *deadline_reached)
+{
+    start_search(solver, start_status, weight, cost_limit);
+    return resume_search(solver, has_deadline, deadline_us, 0, deadline_reached);
+}
+
+/**
+ * @brief Function to go on with the solve started by dj_solver_astar_begin
+ * @note Each call expands at least one search node, so the solve always progresses
+ *
+ * @param solver Pointer to the solver
+ * @param has_deadline True if the solve must be stopped at the deadline
+ * @param deadline_us Deadline of the solve (see dj_dep_get_time_us)
+ * @return bool True if the solve is finished
+ */
+static bool resume_solve(dj_solver_astar_t *solver, bool has_deadline, uint32_t deadline_us)
+{
+    dj_solver_search_t *search = &solver->workspace->m_search;
+
+    while (solver->is_solving)
+    {
+        bool deadline_reached;
+        int32_t goal_index = resume_search(solver, has_deadline, deadline_us, 1, &deadline_reached);
+        if (deadline_reached)
+        {
+            return false;
+        }
+
+        // The search stops on the solution, its path is built from the search tree
+        if (goal_index != -1)
+        {
+            dj_solver_common_build_path(search, goal_index, &solver->solution);
+            solver->best_duration = search_node_list_get(&search->m_nodes, goal_index)->m_evaluation.m_duration;
+            dj_debug_printf("Solution found with weight %d/100 (%d ms)\n",
+                            (int)(solver->weight * 100),
+                            (int)solver->best_duration);
+        }
+
+        if (solver->best_duration == UINT32_MAX)
+        {
+            // No path at all
+            solver->is_solving = false;
+            break;
+        }
+
+        // A finished search with the weight 1 gives the fastest path
+        solver->bound = (solver->weight <= 1.0f) ? 1.0f : get_bound(search, solver->best_duration, goal_index, false);
+        if (solver->bound <= 1.0f + solver->epsilon)
+        {
+            solver->is_solving = false;
+            break;
+        }
+
+        // The second search only keeps the paths which can be faster than the first solution
+        solver->weight = 1.0f;
+        start_search(solver, solver->start_status, solver->weight, solver->best_duration);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Function to get the bound of the ratio between the duration of the best path found and the fastest one
+ *
+ * @param search Last search
+ * @param best_duration Duration of the best path found
+ * @param goal_index Result of the last search (see search_path)
+ * @param deadline_reached True if the last search has been stopped by the deadline
+ * @return float Bound of the ratio
+ */
+static float get_bound(dj_solver_search_t *search, time32_t best_duration, int32_t goal_index, bool deadline_reached)
+{
+    // No faster path can be found by a finished search, otherwise the fastest one can't be faster than
+    // the lowest estimation of the states left to explore
+    time32_t lower_bound
+        = (goal_index == -1 && !deadline_reached) ? best_duration : dj_solver_common_get_lower_bound(search);
+    return (float)best_duration / (float)MAX(MIN(lower_bound, best_duration), 1);
+}
+
+/**
+ * @brief Function to get the length of a path along the segments of another path
+ *
+ * @param [in] path Path
+ * @param [in] other_path Other path
+ * @param [out] length Length of the path (mm)
+ * @return uint32_t Length of the path along the segments of the other path (mm)
+ */
+static uint32_t get_shared_length(dj_graph_path_t *path, dj_graph_path_t *other_path, uint32_t *length)
+{
+    uint32_t shared_length = 0;
+    *length = 0;
+    uint32_t nb_points = dj_graph_path_get_point_count(path);
+    uint32_t nb_other_points = dj_graph_path_get_point_count(other_path);
+    for (uint32_t i = 1; i < nb_points; i++)
+    {
+        GEOMETRY_point_t a, b;
+        dj_graph_path_get_point(path, &a, i - 1);
+        dj_graph_path_get_point(path, &b, i);
+        uint32_t segment_length = GEOMETRY_distance(a, b);
+        *length += segment_length;
+
+        for (uint32_t j = 1; j < nb_other_points; j++)
+        {
+            GEOMETRY_point_t c, d;
+            dj_graph_path_get_point(other_path, &c, j - 1);
+            dj_graph_path_get_point(other_path, &d, j);
+            bool is_same = a.x == c.x && a.y == c.y && b.x == d.x && b.y == d.y;
+            bool is_reversed = a.x == d.x && a.y == d.y && b.x == c.x && b.y == c.y;
+            if (is_same || is_reversed)
+            {
+                shared_length += segment_length;
+                break;
+            }
+        }
+    }
+    return shared_length;
+}
+
+/**
+ * @brief Function to check if a path is distinct enough from the paths already kept
+ * @see DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP
+ *
+ * @param path Path to check
+ * @param paths Paths already kept
+ * @param nb_paths Number of paths already kept
+ * @return bool True if the path can be kept
+ */
+static bool is_distinct_path(dj_graph_path_t *path, dj_graph_path_t *paths, uint32_t nb_paths)
+{
+    for (uint32_t i = 0; i < nb_paths; i++)
+    {
+        uint32_t length;
+        uint32_t shared_length = get_shared_length(path, &paths[i], &length);
+        if ((float)shared_length > DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP * (float)length)
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
 /* *********************************************** Public functions declarations ***************************************** */
 
-void dj_solver_astar_init(dj_solver_astar_t *solver, dj_graph_builder_t *graph_builder)
+void dj_solver_astar_init(dj_solver_astar_t *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace)
 {
-    dj_control_non_null(solver, ) dj_control_non_null(graph_builder, ) solver->graph_builder = graph_builder;
+    dj_control_non_null(solver, ) dj_control_non_null(graph_builder, ) dj_control_non_null(workspace, )
+        solver->graph_builder = graph_builder;
+    solver->workspace = workspace;
+    solver->heuristic = DJ_SOLVER_ASTAR_HEURISTIC;
+    solver->epsilon = DJ_SOLVER_ASTAR_EPSILON;
     // Initialize the solution with invalid values
     dj_viewer_status_t start_status;
     viewer_status_init(&start_status, &(GEOMETRY_point_t){0, 0}, &(GEOMETRY_vector_t){0, 0}, 0);
     dj_graph_path_init(&solver->solution, &start_status);
+    solver->bound = 0.0f;
+    solver->is_solving = false;
 }
 
 void dj_solver_astar_deinit(dj_solver_astar_t *solver)
@@ -54,6 +321,12 @@ void dj_solver_astar_deinit(dj_solver_astar_t *solver)
     dj_control_non_null(solver, ) dj_graph_path_deinit(&solver->solution);
 }
 
+void dj_solver_astar_set_epsilon(dj_solver_astar_t *solver, float epsilon)
+{
+    dj_control_non_null(solver, );
+    solver->epsilon = MAX(epsilon, 0.0f);
+}
+
 void dj_solver_astar_solve(dj_solver_astar_t *solver, dj_viewer_status_t *start_status)
 {
     dj_control_non_null(solver, ) dj_control_non_null(start_status, )
@@ -61,116 +334,152 @@ void dj_solver_astar_solve(dj_solver_astar_t *solver, dj_viewer_status_t *start_
         dj_debug_printf("Start of the solve algorithm\n");
     dj_mark_start_time(DJ_MARK_SOLVE);
 
-    dj_graph_path_t *current_path = NULL;
-    bool path_end_reached = false;
+    dj_solver_astar_begin(solver, start_status);
+    resume_solve(solver, false, 0);
 
-    dj_solver_common_init_paths(&path_list, &current_path, start_status);
-    dj_control_non_null(current_path, )
+    dj_mark_end_time(DJ_MARK_SOLVE);
+    dj_debug_printf("End of the solve algorithm (bound %d/100)\n", (int)(solver->bound * 100));
+}
 
-        GEOMETRY_point_t goal_position
-        = solver->graph_builder->m_graph.end->m_pos;
+void dj_solver_astar_begin(dj_solver_astar_t *solver, dj_viewer_status_t *start_status)
+{
+    dj_control_non_null(solver, );
+    dj_control_non_null(start_status, );
 
-    do
-    {
-        dj_viewer_status_t current_status;
-        dj_graph_path_get_end_status(current_path, &current_status);
-        rebuild_graph_with_prebuilt_graph(solver->graph_builder, &current_status);
+    dj_solver_heuristic_prepare(solver->heuristic, &solver->workspace->m_heuristic_data, &solver->graph_builder->m_graph);
 
-        path_end_reached = true; // Reset path_end_reached for each iteration
+    solver->start_status = start_status;
+    solver->best_duration = UINT32_MAX;
+    solver->weight = 1.0f + solver->epsilon;
+    solver->is_solving = true;
+    start_search(solver, start_status, solver->weight, solver->best_duration);
+}
 
-        // Get all nodes that are reachable from the end of the current path
-        for (uint32_t link_index = 0; link_index < dj_graph_graph_get_num_links(&solver->graph_builder->m_graph);
-             link_index++)
+bool dj_solver_astar_step(dj_solver_astar_t *solver, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, true);
+    return resume_solve(solver, true, deadline_us);
+}
+
+void dj_solver_astar_solve_before(dj_solver_astar_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, ) dj_control_non_null(start_status, )
+
+        dj_debug_printf("Start of the anytime solve algorithm\n");
+    dj_mark_start_time(DJ_MARK_SOLVE);
+
+    dj_solver_heuristic_prepare(solver->heuristic, &solver->workspace->m_heuristic_data, &solver->graph_builder->m_graph);
+    dj_solver_search_t *search = &solver->workspace->m_search;
+
+    time32_t best_duration = UINT32_MAX;
+    float weight = DJ_SOLVER_ANYTIME_INITIAL_WEIGHT;
+    bool deadline_reached = false;
+
+    while (!deadline_reached)
+    {
+        // Each search only keeps the paths which can be faster than the best one
+        int32_t goal_index
+            = search_path(solver, start_status, weight, best_duration, true, deadline_us, &deadline_reached);
+
+        if (goal_index != -1)
         {
-            // Get the link
-            dj_graph_link_t *link = dj_graph_graph_get_link(&solver->graph_builder->m_graph, link_index);
-            dj_control_non_null(link, );
+            dj_solver_common_build_path(search, goal_index, &solver->solution);
+            best_duration = search_node_list_get(&search->m_nodes, goal_index)->m_evaluation.m_duration;
+            dj_debug_printf("Solution found with weight %d/100 (%d ms)\n", (int)(weight * 100), (int)best_duration);
+        }
 
-            // Check if the link is reachable
-            dj_graph_node_t *node = dj_graph_link_is_connected_to_pos(link, &current_status.m_position);
-            if (node == NULL)
+        if (best_duration == UINT32_MAX)
+        {
+            // No path at all, or the best partial path if it hasn't been found in time
+            if (deadline_reached)
             {
-                continue;
-            }
-
-            // Check if the node is already in the current path
-            if (!dj_graph_path_is_in_path(current_path, &node->m_pos) && link->m_enabled)
-            {
-                // Check if the end point is already in the path_list
-                int32_t index_in_list = dj_graph_solver_index_in_list(&path_list, &node->m_pos);
-                if (index_in_list == -1)
-                {
-                    // Add the new path to the list
-                    dj_graph_path_t *new_path_added_to_list = path_list_add(&path_list, NULL);
-                    dj_control_non_null(new_path_added_to_list, ) dj_graph_path_copy(new_path_added_to_list, current_path);
-                    dj_graph_path_add_point(new_path_added_to_list, &node->m_pos);
-                    path_end_reached = false;
-                }
-                else
-                {
-                    // Check if the new path is better than the one already in the list
-                    dj_graph_path_t *existing_path = path_list_get(&path_list, index_in_list);
-                    dj_control_non_null(existing_path, ) dj_graph_path_t new_path_to_check;
-                    dj_graph_path_copy(&new_path_to_check, current_path);
-                    dj_graph_path_add_point(&new_path_to_check, &node->m_pos);
-                    if (dj_graph_path_get_duration(&new_path_to_check) < dj_graph_path_get_duration(existing_path))
-                    {
-                        // Replace the existing path with the new one
-                        dj_graph_path_deinit(existing_path);
-                        dj_graph_path_copy(existing_path, &new_path_to_check);
-                        path_end_reached = false;
-                    }
-                    dj_graph_path_deinit(&new_path_to_check);
-                }
+                dj_solver_common_build_path(search, dj_solver_common_get_closest_node(search), &solver->solution);
+                dj_debug_printf("No solution found in time, partial path kept\n");
             }
+            solver->bound = 0.0f;
+            break;
         }
 
-        // The current path is finished if we have reached any node
-        if (path_end_reached)
+        solver->bound = get_bound(search, best_duration, goal_index, deadline_reached);
+
+        if (weight <= 1.0f || solver->bound <= 1.0f + solver->epsilon)
         {
-            dj_graph_path_set_as_finished(current_path, true);
+            break;
         }
-
-        current_path = dj_solver_common_find_next_path(&path_list, true, &goal_position);
-    } while (current_path != NULL
-             && (current_path->m_end_status.m_position.x != solver->graph_builder->m_graph.end->m_pos.x
-                 || current_path->m_end_status.m_position.y != solver->graph_builder->m_graph.end->m_pos.y));
+        weight = MAX(weight - DJ_SOLVER_ANYTIME_WEIGHT_STEP, 1.0f);
+    }
 
     dj_mark_end_time(DJ_MARK_SOLVE);
-    dj_debug_printf("End of the solve algorithm\n");
+    dj_debug_printf("End of the anytime solve algorithm (bound %d/100)\n", (int)(solver->bound * 100));
+}
 
-    // Print all the paths generated
-    // Print all the nodes
-#if DJ_ENABLE_DEBUG_LOGS
-    dj_debug_printf("Genrated paths:\n");
-    for (int i = 0; i < path_list_size(&path_list); i++)
+uint32_t dj_solver_astar_solve_alternatives(dj_solver_astar_t *solver,
+                                            dj_viewer_status_t *start_status,
+                                            dj_graph_path_t *paths,
+                                            uint32_t max_paths)
+{
+    dj_control_non_null(solver, 0);
+    dj_control_non_null(start_status, 0);
+    dj_control_non_null(paths, 0);
+
+    dj_debug_printf("Start of the alternatives solve algorithm\n");
+    dj_mark_start_time(DJ_MARK_SOLVE);
+
+    dj_solver_heuristic_prepare(solver->heuristic, &solver->workspace->m_heuristic_data, &solver->graph_builder->m_graph);
+    dj_solver_search_t *search = &solver->workspace->m_search;
+
+    GEOMETRY_point_t goal_position = solver->graph_builder->m_graph.end->m_pos;
+    int32_t current_index = dj_solver_common_init_nodes(
+        search, start_status, solver->heuristic, &solver->workspace->m_heuristic_data, &goal_position, 1.0f, UINT32_MAX);
+    // A faster path to the goal mustn't replace the slower ones, they are the alternatives
+    search->m_keep_goal_states = true;
+
+    uint32_t nb_paths = 0;
+    time32_t best_duration = UINT32_MAX;
+    while (current_index != -1 && nb_paths < max_paths)
     {
-        dj_graph_path_t *path = path_list_get(&path_list, i);
-        dj_debug_printf("Path %d: (%d ms)", i, (int)dj_graph_path_get_duration(path));
-        for (int j = 0; j < dj_graph_path_get_point_count(path); j++)
+        dj_solver_search_node_t *current_node = search_node_list_get(&search->m_nodes, current_index);
+        dj_control_non_null(current_node, nb_paths);
+
+        // The next states can't give a path fast enough
+        if (best_duration != UINT32_MAX
+            && (float)current_node->m_estimation > DJ_SOLVER_ALTERNATIVE_MAX_STRETCH * (float)best_duration)
+        {
+            break;
+        }
+
+        if (current_node->m_position.x == goal_position.x && current_node->m_position.y == goal_position.y)
+        {
+            // The goal states are reached from the fastest to the slowest, each one ends a path
+            current_node->m_is_finished = true;
+            dj_solver_common_build_path(search, current_index, &paths[nb_paths]);
+            if (is_distinct_path(&paths[nb_paths], paths, nb_paths))
+            {
+                if (nb_paths == 0)
+                {
+                    best_duration = current_node->m_evaluation.m_duration;
+                }
+                dj_debug_printf("Path %d found (%d ms)\n", (int)nb_paths, (int)current_node->m_evaluation.m_duration);
+                nb_paths++;
+            }
+        }
+        else
         {
-            GEOMETRY_point_t point;
-            dj_graph_path_get_point(path, &point, j);
-            dj_debug_printf("(%d, %d) ", point.x, point.y);
+            dj_solver_common_expand_node(search, current_index, solver->graph_builder);
         }
-        dj_debug_printf("\n");
+
+        current_index = dj_solver_common_find_next_node(search);
     }
-#endif
 
-    // Shearch the solution in the path list
-    for (uint32_t i = 0; i < path_list_size(&path_list); i++)
+    if (nb_paths > 0)
     {
-        dj_graph_path_t *path = path_list_get(&path_list, i);
-        dj_control_non_null(path, ) if (path->m_end_status.m_position.x == solver->graph_builder->m_graph.end->m_pos.x
-                                        && path->m_end_status.m_position.y == solver->graph_builder->m_graph.end->m_pos.y)
-        {
-            dj_graph_path_copy(&solver->solution, path);
-            dj_debug_printf("Solution found\n");
-            break;
-        }
+        dj_graph_path_copy(&solver->solution, &paths[0]);
+        solver->bound = 1.0f;
     }
 
-    dj_solver_common_deinit_paths(&path_list);
+    dj_mark_end_time(DJ_MARK_SOLVE);
+    dj_debug_printf("End of the alternatives solve algorithm (%d paths)\n", (int)nb_paths);
+    return nb_paths;
 }
 
 void dj_solver_astar_get_solution(dj_solver_astar_t *solver, dj_graph_path_t *solution)
@@ -178,4 +487,10 @@ void dj_solver_astar_get_solution(dj_solver_astar_t *solver, dj_graph_path_t *so
     dj_control_non_null(solver, ) dj_control_non_null(solution, ) dj_graph_path_copy(solution, &solver->solution);
 }
 
+float dj_solver_astar_get_bound(dj_solver_astar_t *solver)
+{
+    dj_control_non_null(solver, 0.0f);
+    return solver->bound;
+}
+
 /* ******************************************* Public callback functions declarations ************************************ */
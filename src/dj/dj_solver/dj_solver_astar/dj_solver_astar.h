@@ -6,8 +6,8 @@
  * @see dj_solver_astar.c
  */
 
-#ifndef __DJ_SOLVER_DIJKSTRA_H__
-#define __DJ_SOLVER_DIJKSTRA_H__
+#ifndef __DJ_SOLVER_ASTAR_H__
+#define __DJ_SOLVER_ASTAR_H__
 
 /* ******************************************************* Includes ****************************************************** */
 
@@ -15,9 +15,20 @@
 #include "../../dj_graph/dj_graph_path.h"
 #include "../../dj_graph_builder/dj_graph_builder.h"
 #include "../../dj_viewer/dj_viewer_status.h"
+#include "../dj_solver_common/dj_solver_common.h"
+#include "../dj_solver_heuristic/dj_solver_heuristic.h"
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Heuristic used by the A* solver to estimate the duration to the goal
+ * @note With an epsilon of 0, all the heuristics give the same durations as long as the search list isn't full
+ *       (see DJ_SOLVER_HEADING_BINS), they only change the number of expansions. The landmarks are the fastest on the
+ *       test scenarios.
+ * @see dj_solver_heuristic.h
+ */
+#define DJ_SOLVER_ASTAR_HEURISTIC dj_solver_heuristic_landmarks
+
 /* ************************************************** Public types definition ******************************************** */
 
 /**
@@ -29,10 +40,47 @@ typedef struct
      * @brief Graph builder to use
      */
     dj_graph_builder_t *graph_builder;
+    /**
+     * @brief Memory used during the solves
+     */
+    dj_solver_workspace_t *workspace;
+    /**
+     * @brief Heuristic of the search (DJ_SOLVER_ASTAR_HEURISTIC by default)
+     */
+    dj_solver_heuristic_t heuristic;
+    /**
+     * @brief Tolerance of the solution : its duration is at most (1 + epsilon) times the fastest one
+     *        (DJ_SOLVER_ASTAR_EPSILON by default)
+     */
+    float epsilon;
     /**
      * @brief Solution of the solver
      */
     dj_graph_path_t solution;
+    /**
+     * @brief Bound of the ratio between the duration of the solution and the fastest one (1 : optimal solution)
+     */
+    float bound;
+    /**
+     * @brief True while the solve started by dj_solver_astar_begin isn't finished
+     */
+    bool is_solving;
+    /**
+     * @brief Start status of the solve (see dj_solver_astar_begin)
+     */
+    dj_viewer_status_t *start_status;
+    /**
+     * @brief Weight of the heuristic of the current search
+     */
+    float weight;
+    /**
+     * @brief Duration of the best path found by the solve (UINT32_MAX if none)
+     */
+    time32_t best_duration;
+    /**
+     * @brief Index of the next search node to explore by the current search (-1 if none)
+     */
+    int32_t current_index;
 } dj_solver_astar_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
@@ -42,8 +90,9 @@ typedef struct
  *
  * @param solver Pointer to the solver to initialize
  * @param graph_builder Pointer to the graph builder to use
+ * @param workspace Pointer to the memory to use during the solves (it musn't be used by another solver at the same time)
  */
-void dj_solver_astar_init(dj_solver_astar_t *solver, dj_graph_builder_t *graph_builder);
+void dj_solver_astar_init(dj_solver_astar_t *solver, dj_graph_builder_t *graph_builder, dj_solver_workspace_t *workspace);
 
 /**
  * @brief Function to deinitialize the solver
@@ -52,13 +101,77 @@ void dj_solver_astar_init(dj_solver_astar_t *solver, dj_graph_builder_t *graph_b
  */
 void dj_solver_astar_deinit(dj_solver_astar_t *solver);
 
+/**
+ * @brief Function to set the tolerance of the solution
+ * @see DJ_SOLVER_ASTAR_EPSILON
+ *
+ * @param solver Pointer to the solver
+ * @param epsilon Tolerance, the duration of the solution is at most (1 + epsilon) times the fastest one
+ */
+void dj_solver_astar_set_epsilon(dj_solver_astar_t *solver, float epsilon);
+
 /**
  * @brief Function to solve the graph
+ * @note With a tolerance, the search is a weighted A* (weight 1 + epsilon). If the bound of the solution found isn't
+ *       within the tolerance, a second search (weight 1) only looks for faster paths.
  *
  * @param solver Pointer to the solver to solve
  */
 void dj_solver_astar_solve(dj_solver_astar_t *solver, dj_viewer_status_t *start_status);
 
+/**
+ * @brief Function to start a solve done by slices (see dj_solver_astar_step)
+ * @note The solve gives the same solution as dj_solver_astar_solve
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the path, it must stay valid until the end of the solve
+ */
+void dj_solver_astar_begin(dj_solver_astar_t *solver, dj_viewer_status_t *start_status);
+
+/**
+ * @brief Function to go on with the solve started by dj_solver_astar_begin until a deadline
+ * @note At least one search node is explored by each call, so the solve always progresses
+ * @note The graph and the workspace musn't be used by anything else between the calls
+ *
+ * @param solver Pointer to the solver
+ * @param deadline_us Time at which the slice must be stopped (see dj_dep_get_time_us)
+ * @return bool True if the solve is finished (the solution can be read), false if it must go on
+ */
+bool dj_solver_astar_step(dj_solver_astar_t *solver, uint32_t deadline_us);
+
+/**
+ * @brief Function to solve the graph before a deadline
+ * @note A first greedy search finds a path quickly, then the next searches improve it until the deadline
+ *       (see DJ_SOLVER_ANYTIME_INITIAL_WEIGHT) or until it is within the tolerance of the solver.
+ *       The best path found is kept as the solution.
+ * @note If no path is found before the deadline, the solution is the path to the search node closest to the end
+ *       (see dj_solver_common_get_closest_node) and the bound is 0
+ *
+ * @param solver Pointer to the solver to solve
+ * @param start_status Start status of the path
+ * @param deadline_us Time at which the solving must be stopped (see dj_dep_get_time_us)
+ */
+void dj_solver_astar_solve_before(dj_solver_astar_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+
+/**
+ * @brief Function to solve the graph and keep alternative paths to the goal
+ * @note The search goes on after the fastest path : each state which reaches the goal gives a path, which is kept
+ *       if at most DJ_SOLVER_ALTERNATIVE_MAX_OVERLAP of its length is along the segments of the paths already kept.
+ *       The search stops when enough paths are kept or when the estimations exceed DJ_SOLVER_ALTERNATIVE_MAX_STRETCH
+ *       times the duration of the fastest path.
+ * @note The first path is the solution of the solver
+ *
+ * @param solver Pointer to the solver to solve
+ * @param start_status Start status of the paths
+ * @param [out] paths Paths found from the fastest to the slowest (they musn't be initialized)
+ * @param max_paths Maximum number of paths
+ * @return uint32_t Number of paths found
+ */
+uint32_t dj_solver_astar_solve_alternatives(dj_solver_astar_t *solver,
+                                            dj_viewer_status_t *start_status,
+                                            dj_graph_path_t *paths,
+                                            uint32_t max_paths);
+
 /**
  * @brief Function to get the solution
  *
@@ -67,6 +180,14 @@ void dj_solver_astar_solve(dj_solver_astar_t *solver, dj_viewer_status_t *start_
  */
 void dj_solver_astar_get_solution(dj_solver_astar_t *solver, dj_graph_path_t *solution);
 
+/**
+ * @brief Function to get the bound of the ratio between the duration of the solution and the fastest path
+ *
+ * @param solver Pointer to the solver
+ * @return float Bound of the ratio (1 : optimal solution, 0 : no solution)
+ */
+float dj_solver_astar_get_bound(dj_solver_astar_t *solver);
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif
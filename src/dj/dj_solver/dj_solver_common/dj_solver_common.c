@@ -8,7 +8,11 @@
 
 /* ******************************************************* Includes ****************************************************** */
 #include "dj_solver_common.h"
+#include "../../dj_graph_builder/dj_prebuilt_graph.h"
 #include "../../dj_logs/dj_logs.h"
+#include "../../dj_prop_config/dj_prop_config.h"
+
+#include <math.h>
 
 /* **************************************************** Private macros *************************************************** */
 
@@ -16,80 +20,490 @@
 
 /* ********************************************* Private functions declarations ****************************************** */
 
+static void get_arrival(const dj_graph_path_evaluation_t *evaluation, dj_solver_search_node_t *node);
+static bool is_dominating(dj_solver_search_t *search,
+                          const dj_solver_search_node_t *node,
+                          const dj_solver_search_node_t *other_node);
+static void release_node(dj_solver_search_t *search, int16_t node_index);
+static void degrade_search(dj_solver_search_t *search, int32_t parent_index);
+static void compute_costs(dj_solver_search_t *search, dj_solver_search_node_t *node);
+
 /* ************************************************** Private variables ************************************************** */
 
 /* ********************************************** Private functions definitions ****************************************** */
 
+/**
+ * @brief Function to get the arrival state of the path of a search node
+ *
+ * @param [in] evaluation Evaluation of the path
+ * @param [out] node Search node whose bins, arrival duration and arrival speed are set
+ */
+static void get_arrival(const dj_graph_path_evaluation_t *evaluation, dj_solver_search_node_t *node)
+{
+    const dj_viewer_status_t *status = &evaluation->m_last_segment_status;
+    GEOMETRY_point_t end = evaluation->m_end_status.m_position;
+
+    // Heading of the last segment (in [-PI4096, PI4096])
+    int32_t heading = GEOMETRY_viewing_angle(status->m_position.x, status->m_position.y, end.x, end.y);
+    node->m_heading_bin = (heading + PI4096) * DJ_SOLVER_HEADING_BINS / (2 * PI4096 + 1);
+
+    /*
+        The last segment ends immobile only until the path is extended,
+        so the arrival is the one of the robot accelerating all along the last segment :
+        v = sqrt(v0^2 + 2 * a * d)
+        t = 1000 * (v - v0) / a
+    */
+    float initial_speed = sqrtf((float)status->m_speed.x * status->m_speed.x + (float)status->m_speed.y * status->m_speed.y);
+    float distance = (float)GEOMETRY_distance(status->m_position, end);
+    node->m_arrival_speed = sqrtf(initial_speed * initial_speed + 2.0f * PROP_LINEAR_ACCELERATION * distance);
+    node->m_arrival_duration = evaluation->m_last_segment_duration
+                               + (time32_t)(1000.0f * (node->m_arrival_speed - initial_speed) / PROP_LINEAR_ACCELERATION);
+    node->m_speed_bin = MIN((uint32_t)node->m_arrival_speed / DJ_SOLVER_SPEED_BIN_WIDTH, DJ_SOLVER_SPEED_BINS - 1);
+}
+
+/**
+ * @brief Function to know if a search node dominates another one
+ * @note Both nodes must reach the same point. At a goal, the node dominates if its path is as fast (unless the goal
+ *       states are kept).
+ *       Elsewhere, it must be in the same heading bin and speed bin, be as fast if the robot stops at the end point,
+ *       and be as fast if it doesn't stop, whatever the remaining distance : it must arrive as early and start as
+ *       early (arrival duration minus the time to reach the arrival speed). The bins are ignored once the search is
+ *       degraded (see degrade_search).
+ * @warning The pre-rotation of the next segment depends on the exact heading and the next segments depend on the exact
+ *          speed, so a dominated node of the same bins can still lead to a faster path. The bins bound this error
+ *          (see DJ_SOLVER_HEADING_BINS).
+ *
+ * @param search Search
+ * @param node Search node
+ * @param other_node Other search node
+ * @return bool True if the node dominates the other one, false otherwise
+ */
+static bool is_dominating(dj_solver_search_t *search,
+                          const dj_solver_search_node_t *node,
+                          const dj_solver_search_node_t *other_node)
+{
+    if (node->m_position.x != other_node->m_position.x || node->m_position.y != other_node->m_position.y)
+    {
+        return false;
+    }
+    if (dj_solver_common_is_goal(search, &node->m_position))
+    {
+        return !search->m_keep_goal_states && node->m_evaluation.m_duration <= other_node->m_evaluation.m_duration;
+    }
+
+    float start_duration = node->m_arrival_duration - 1000.0f * node->m_arrival_speed / PROP_LINEAR_ACCELERATION;
+    float other_start_duration
+        = other_node->m_arrival_duration - 1000.0f * other_node->m_arrival_speed / PROP_LINEAR_ACCELERATION;
+    bool is_same_bin = search->m_is_degraded
+                       || (node->m_heading_bin == other_node->m_heading_bin && node->m_speed_bin == other_node->m_speed_bin);
+    return is_same_bin && node->m_evaluation.m_duration <= other_node->m_evaluation.m_duration
+           && node->m_arrival_duration <= other_node->m_arrival_duration && start_duration <= other_start_duration;
+}
+
+/**
+ * @brief Function to release the slot of a superseded search node without children
+ * @note The parent loses a child, so it is released too if it is superseded and has no more children
+ *
+ * @param search Search
+ * @param node_index Index of the search node to release
+ */
+static void release_node(dj_solver_search_t *search, int16_t node_index)
+{
+    while (node_index != -1)
+    {
+        dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, node_index);
+        if (!node->m_is_superseded || node->m_nb_children != 0)
+        {
+            return;
+        }
+        node->m_next_index = search->m_free_index;
+        search->m_free_index = node_index;
+
+        node_index = node->m_parent_index;
+        search_node_list_get(&search->m_nodes, node_index)->m_nb_children--;
+    }
+}
+
+/**
+ * @brief Function to ignore the bins in the dominance once the node list is full
+ * @note The states dominated by another state of the same end point are superseded to release their slots.
+ *       The search goes on with fewer states, it may not find the fastest path anymore.
+ *
+ * @param search Search
+ * @param parent_index Index of the search node being expanded (it is kept)
+ */
+static void degrade_search(dj_solver_search_t *search, int32_t parent_index)
+{
+    dj_debug_printf("Search node list full, the bins are ignored\n");
+    search->m_is_degraded = true;
+    for (uint32_t bucket = 0; bucket < DJ_SOLVER_SEARCH_HASH_BUCKETS; bucket++)
+    {
+        int16_t *link = &search->m_buckets[bucket];
+        while (*link != -1)
+        {
+            int16_t node_index = *link;
+            dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, node_index);
+            bool is_dominated = false;
+            for (int16_t i = search->m_buckets[bucket]; i != -1 && !is_dominated;
+                 i = search_node_list_get(&search->m_nodes, i)->m_next_index)
+            {
+                is_dominated = i != node_index && is_dominating(search, search_node_list_get(&search->m_nodes, i), node);
+            }
+            if (is_dominated && node_index != parent_index)
+            {
+                *link = node->m_next_index;
+                node->m_is_superseded = true;
+                node->m_is_finished = true;
+                release_node(search, node_index);
+            }
+            else
+            {
+                link = &node->m_next_index;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Function to compute the estimation and the cost of a search node from its evaluation
+ *
+ * @param search Search
+ * @param node Search node
+ */
+static void compute_costs(dj_solver_search_t *search, dj_solver_search_node_t *node)
+{
+    node->m_estimation = search->m_heuristic(search->m_heuristic_data, &node->m_evaluation, &search->m_goal_position);
+
+    // Only the estimated part of the duration is weighted (the duration until the last segment is known)
+    time32_t known_duration = MIN(node->m_evaluation.m_last_segment_duration, node->m_estimation);
+    node->m_cost = known_duration + (time32_t)(search->m_weight * (node->m_estimation - known_duration));
+}
+
 /* ********************************************** Public functions definitions ******************************************* */
 
-MAGIC_ARRAY_SRC(path_list, dj_graph_path_t);
+MAGIC_ARRAY_SRC(search_node_list, dj_solver_search_node_t);
+
+void dj_solver_common_init_workspace(dj_solver_workspace_t *workspace)
+{
+    dj_control_non_null(workspace, );
+    search_node_list_init(&workspace->m_search.m_nodes);
+    workspace->m_search.m_nb_expansions = 0;
+    dj_solver_heuristic_init_data(&workspace->m_heuristic_data);
+}
+
+int32_t dj_solver_common_init_nodes(dj_solver_search_t *search,
+                                    dj_viewer_status_t *start_status,
+                                    dj_solver_heuristic_t heuristic,
+                                    dj_solver_heuristic_data_t *heuristic_data,
+                                    GEOMETRY_point_t *goal_position,
+                                    float weight,
+                                    time32_t cost_limit)
+{
+    dj_control_non_null(search, -1);
+    dj_control_non_null(start_status, -1);
+    dj_control_non_null(heuristic, -1);
+    dj_control_non_null(heuristic_data, -1);
+    dj_control_non_null(goal_position, -1);
+
+    search_node_list_init(&search->m_nodes);
+    for (uint32_t i = 0; i < DJ_SOLVER_SEARCH_HASH_BUCKETS; i++)
+    {
+        search->m_buckets[i] = -1;
+    }
+    search->m_free_index = -1;
+    search->m_is_degraded = false;
+    search->m_keep_goal_states = false;
+    search->m_heuristic = heuristic;
+    search->m_heuristic_data = heuristic_data;
+    search->m_goal_position = *goal_position;
+    search->m_nb_other_goals = 0;
+    search->m_weight = weight;
+    search->m_cost_limit = cost_limit;
+
+    dj_solver_search_node_t *root = search_node_list_add(&search->m_nodes, NULL);
+    dj_control_non_null(root, -1);
+    root->m_position = start_status->m_position;
+    root->m_parent_index = -1;
+    root->m_nb_children = 0;
+    dj_graph_path_evaluation_init(&root->m_evaluation, start_status);
+    get_arrival(&root->m_evaluation, root);
+    compute_costs(search, root);
+    root->m_is_finished = false;
+    root->m_is_superseded = false;
+
+    uint32_t bucket = dj_graph_node_get_bucket(&root->m_position, DJ_SOLVER_SEARCH_HASH_BUCKETS);
+    root->m_next_index = search->m_buckets[bucket];
+    search->m_buckets[bucket] = 0;
+    return 0;
+}
+
+void dj_solver_common_build_path(dj_solver_search_t *search, int32_t node_index, dj_graph_path_t *path)
+{
+    dj_control_non_null(search, );
+    dj_control_non_null(path, );
+
+    // Walk the parents up to the root
+    int16_t indexes[DJ_GRAPH_PATH_MAX_POINTS];
+    uint32_t nb_indexes = 0;
+    for (int32_t index = node_index; index != -1; index = search_node_list_get(&search->m_nodes, index)->m_parent_index)
+    {
+        if (nb_indexes >= DJ_GRAPH_PATH_MAX_POINTS)
+        {
+            dj_error_printf("Search node %d is too deep to build its path\n", (int)node_index);
+            break;
+        }
+        indexes[nb_indexes++] = index;
+    }
+    if (nb_indexes == 0)
+    {
+        return;
+    }
+
+    // The root stores the initial status, the other nodes are added from the root to the last one
+    dj_graph_path_init(path, &search_node_list_get(&search->m_nodes, indexes[nb_indexes - 1])->m_evaluation.m_end_status);
+    for (int32_t i = nb_indexes - 2; i >= 0; i--)
+    {
+        dj_graph_path_add_point(path, &search_node_list_get(&search->m_nodes, indexes[i])->m_position);
+    }
+}
+
+bool dj_solver_common_is_goal(dj_solver_search_t *search, const GEOMETRY_point_t *point)
+{
+    dj_control_non_null(search, false);
+    dj_control_non_null(point, false);
+
+    if (point->x == search->m_goal_position.x && point->y == search->m_goal_position.y)
+    {
+        return true;
+    }
+    for (uint32_t i = 0; i < search->m_nb_other_goals; i++)
+    {
+        if (point->x == search->m_other_goals[i].x && point->y == search->m_other_goals[i].y)
+        {
+            return true;
+        }
+    }
+    return false;
+}
 
-int32_t dj_graph_solver_index_in_list(path_list_t *list, GEOMETRY_point_t *end_point)
+bool dj_solver_common_is_in_path(dj_solver_search_t *search, int32_t node_index, GEOMETRY_point_t *point)
 {
-    dj_control_non_null(list, -1);
-    dj_control_non_null(end_point, -1);
+    dj_control_non_null(search, false);
+    dj_control_non_null(point, false);
 
-    for (int32_t i = 0; i < path_list_size(list); i++)
+    for (int32_t index = node_index; index != -1; index = search_node_list_get(&search->m_nodes, index)->m_parent_index)
     {
-        GEOMETRY_point_t current_end_point;
-        dj_graph_path_get_end(path_list_get(list, i), &current_end_point);
-        if (end_point->x == current_end_point.x && end_point->y == current_end_point.y)
+        dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, index);
+        if (node->m_position.x == point->x && node->m_position.y == point->y)
         {
-            return i;
+            return true;
         }
     }
-    return -1;
+    return false;
 }
 
-void dj_solver_common_init_paths(path_list_t *path_list, dj_graph_path_t **current_path, dj_viewer_status_t *start_status)
+bool dj_solver_common_add_candidate(dj_solver_search_t *search, int32_t parent_index, GEOMETRY_point_t *position)
 {
-    dj_control_non_null(path_list, );
-    dj_control_non_null(current_path, );
-    dj_control_non_null(start_status, );
+    dj_control_non_null(search, false);
+    dj_control_non_null(position, false);
+
+    // Evaluate the candidate path from the evaluation of its parent
+    dj_solver_search_node_t *parent = search_node_list_get(&search->m_nodes, parent_index);
+    dj_control_non_null(parent, false);
+    dj_graph_path_evaluation_t evaluation;
+    dj_graph_path_evaluation_extend(&evaluation, &parent->m_evaluation, position);
+
+    // Drop the candidate if it can't be better than the limit
+    if (search->m_cost_limit != UINT32_MAX
+        && search->m_heuristic(search->m_heuristic_data, &evaluation, &search->m_goal_position) >= search->m_cost_limit)
+    {
+        return false;
+    }
+
+    dj_solver_search_node_t candidate;
+    candidate.m_position = *position;
+    candidate.m_evaluation = evaluation;
+    get_arrival(&evaluation, &candidate);
+
+    // Keep fewer states once the list is full
+    if (!search->m_is_degraded && search->m_free_index == -1 && search_node_list_is_full(&search->m_nodes))
+    {
+        degrade_search(search, parent_index);
+    }
+
+    // Drop the candidate if another state dominates it
+    uint32_t bucket = dj_graph_node_get_bucket(position, DJ_SOLVER_SEARCH_HASH_BUCKETS);
+    for (int16_t i = search->m_buckets[bucket]; i != -1; i = search_node_list_get(&search->m_nodes, i)->m_next_index)
+    {
+        if (is_dominating(search, search_node_list_get(&search->m_nodes, i), &candidate))
+        {
+            return false;
+        }
+    }
+
+    // Supersede the states dominated by the candidate (they are removed from the hash map)
+    int16_t *link = &search->m_buckets[bucket];
+    while (*link != -1)
+    {
+        int16_t existing_index = *link;
+        dj_solver_search_node_t *existing_node = search_node_list_get(&search->m_nodes, existing_index);
+        if (is_dominating(search, &candidate, existing_node))
+        {
+            *link = existing_node->m_next_index;
+            existing_node->m_is_superseded = true;
+            existing_node->m_is_finished = true;
+            // Nobody goes through a superseded node without children, its slot can be reused
+            release_node(search, existing_index);
+        }
+        else
+        {
+            link = &existing_node->m_next_index;
+        }
+    }
+
+    // Reuse a released slot if any, the candidate is dropped if the list is still full
+    int16_t node_index = search->m_free_index;
+    dj_solver_search_node_t *node = NULL;
+    if (node_index != -1)
+    {
+        node = search_node_list_get(&search->m_nodes, node_index);
+        search->m_free_index = node->m_next_index;
+    }
+    else if (!search_node_list_is_full(&search->m_nodes))
+    {
+        node_index = search_node_list_size(&search->m_nodes);
+        node = search_node_list_add(&search->m_nodes, NULL);
+    }
+    if (node == NULL)
+    {
+        dj_debug_printf("Search node list full, candidate (%d, %d) dropped\n", position->x, position->y);
+        return false;
+    }
 
-    path_list_init(path_list);
-    dj_graph_path_t *new_path = path_list_add(path_list, NULL);
-    dj_graph_path_init(new_path, start_status);
-    *current_path = new_path;
+    node->m_position = *position;
+    node->m_parent_index = parent_index;
+    node->m_nb_children = 0;
+    node->m_heading_bin = candidate.m_heading_bin;
+    node->m_speed_bin = candidate.m_speed_bin;
+    node->m_arrival_duration = candidate.m_arrival_duration;
+    node->m_arrival_speed = candidate.m_arrival_speed;
+    node->m_evaluation = evaluation;
+    compute_costs(search, node);
+    node->m_is_finished = false;
+    node->m_is_superseded = false;
+    node->m_next_index = search->m_buckets[bucket];
+    search->m_buckets[bucket] = node_index;
+    parent->m_nb_children++;
+    return true;
 }
 
-void dj_solver_common_deinit_paths(path_list_t *path_list)
+void dj_solver_common_expand_node(dj_solver_search_t *search, int32_t node_index, dj_graph_builder_t *graph_builder)
 {
-    dj_control_non_null(path_list, );
-    for (uint32_t i = 0; i < path_list_size(path_list); i++)
+    dj_control_non_null(search, );
+    dj_control_non_null(graph_builder, );
+
+    dj_solver_search_node_t *current_node = search_node_list_get(&search->m_nodes, node_index);
+    dj_control_non_null(current_node, );
+    search->m_nb_expansions++;
+    dj_viewer_status_t current_status = current_node->m_evaluation.m_end_status;
+    rebuild_graph_with_prebuilt_graph(graph_builder, &current_status);
+
+    // Get all nodes that are reachable from the end of the current path
+    for (uint32_t link_index = 0; link_index < dj_graph_graph_get_num_links(&graph_builder->m_graph); link_index++)
     {
-        dj_graph_path_deinit(path_list_get(path_list, i));
+        // Get the link
+        dj_graph_link_t *link = dj_graph_graph_get_link(&graph_builder->m_graph, link_index);
+        dj_control_non_null(link, );
+
+        // Check if the link is reachable
+        dj_graph_node_t *node = dj_graph_link_is_connected_to_pos(link, &current_status.m_position);
+        if (node == NULL)
+        {
+            continue;
+        }
+
+        // Check if the node is already in the current path
+        if (!dj_solver_common_is_in_path(search, node_index, &node->m_pos) && link->m_enabled)
+        {
+            // Add the new search node (or replace a worse one which reaches the same point)
+            dj_solver_common_add_candidate(search, node_index, &node->m_pos);
+        }
     }
+
+    // The current search node is finished : expanding it again would only give the same candidates, which are
+    // dominated by the first ones (or, at the goal, would duplicate them when the goal states are kept)
+    current_node->m_is_finished = true;
 }
 
-dj_graph_path_t *dj_solver_common_find_next_path(path_list_t *path_list, bool use_heuristic, GEOMETRY_point_t *goal_position)
+int32_t dj_solver_common_find_next_node(dj_solver_search_t *search)
 {
-    dj_control_non_null(path_list, NULL);
+    dj_control_non_null(search, -1);
 
-    dj_graph_path_t *next_path = NULL;
-    uint32_t path_list_count = path_list_size(path_list);
+    int32_t next_index = -1;
+    time32_t next_cost = 0;
+    uint32_t list_count = search_node_list_size(&search->m_nodes);
 
-    for (int i = 0; i < path_list_count; i++)
+    for (uint32_t i = 0; i < list_count; i++)
     {
-        dj_graph_path_t *path = path_list_get(path_list, i);
-        if (!dj_graph_path_is_finished(path))
+        dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, i);
+        if (!node->m_is_finished && (next_index == -1 || node->m_cost < next_cost))
         {
-            int32_t cost = dj_graph_path_get_duration(path);
-            if (use_heuristic && goal_position != NULL)
-            {
-                GEOMETRY_point_t current_end_point;
-                dj_graph_path_get_end(path, &current_end_point);
-                cost += GEOMETRY_manhattan_distance(current_end_point, *goal_position);
-            }
+            next_index = i;
+            next_cost = node->m_cost;
+        }
+    }
 
-            if (next_path == NULL || cost < dj_graph_path_get_duration(next_path))
-            {
-                next_path = path;
-            }
+    return next_index;
+}
+
+time32_t dj_solver_common_get_lower_bound(dj_solver_search_t *search)
+{
+    dj_control_non_null(search, UINT32_MAX);
+
+    time32_t lower_bound = UINT32_MAX;
+    for (uint32_t i = 0; i < search_node_list_size(&search->m_nodes); i++)
+    {
+        dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, i);
+        if (!node->m_is_finished)
+        {
+            lower_bound = MIN(lower_bound, node->m_estimation);
+        }
+    }
+    return lower_bound;
+}
+
+int32_t dj_solver_common_get_closest_node(dj_solver_search_t *search)
+{
+    dj_control_non_null(search, 0);
+
+    // The partial path is the root alone if no search node is closer to the goal
+    int32_t closest_index = 0;
+    uint32_t closest_distance = UINT32_MAX;
+    time32_t closest_duration = UINT32_MAX;
+    for (uint32_t i = 0; i < search_node_list_size(&search->m_nodes); i++)
+    {
+        dj_solver_search_node_t *node = search_node_list_get(&search->m_nodes, i);
+        if (node->m_is_superseded)
+        {
+            continue;
+        }
+        uint32_t distance = GEOMETRY_distance(node->m_position, search->m_goal_position);
+        if (distance < closest_distance
+            || (distance == closest_distance && node->m_evaluation.m_duration < closest_duration))
+        {
+            closest_index = (int32_t)i;
+            closest_distance = distance;
+            closest_duration = node->m_evaluation.m_duration;
         }
     }
+    return closest_index;
+}
 
-    return next_path;
+bool dj_solver_common_is_deadline_reached(uint32_t deadline_us)
+{
+    uint32_t now_us;
+    dj_dep_get_time_us(&now_us);
+    return (int32_t)(now_us - deadline_us) >= 0;
 }
 
 /* ***************************************** Public callback functions definitions *************************************** */
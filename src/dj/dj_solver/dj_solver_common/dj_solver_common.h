@@ -14,54 +14,289 @@
 #include "../../dj_dependencies/dj_dependencies.h"
 #include "../../dj_graph/dj_graph_graph.h"
 #include "../../dj_graph/dj_graph_path.h"
+#include "../../dj_graph_builder/dj_graph_builder.h"
 #include "../../dj_viewer/dj_viewer_status.h"
+#include "../dj_solver_heuristic/dj_solver_heuristic.h"
 
 /* ***************************************************** Public macros *************************************************** */
 
+/**
+ * @brief Number of buckets of the hash map of the search states (indexed by the end point of the states)
+ */
+#define DJ_SOLVER_SEARCH_HASH_BUCKETS (2 * DJ_GRAPH_GRAPH_MAX_NODES)
+
 /* ************************************************** Public types definition ******************************************** */
 
-MAGIC_ARRAY_TYPEDEF(path_list, dj_graph_path_t, DJ_GRAPH_GRAPH_MAX_NODES);
+/**
+ * @brief Node of the search tree built by the solvers
+ * @note A search node only stores the last point of its path and the index of its parent,
+ *       the whole path is only materialised for the solution (see dj_solver_common_build_path)
+ */
+typedef struct
+{
+    /**
+     * @brief Position of the graph node reached by this search node
+     * @note The position is used instead of the graph node index because the graph is rebuilt for each viewer
+     */
+    GEOMETRY_point_t m_position;
+    /**
+     * @brief Index of the parent search node in the list (-1 for the root)
+     */
+    int16_t m_parent_index;
+    /**
+     * @brief Number of search nodes which have this node as parent
+     */
+    uint16_t m_nb_children;
+    /**
+     * @brief Bin of the heading of the last segment (see DJ_SOLVER_HEADING_BINS)
+     */
+    uint8_t m_heading_bin;
+    /**
+     * @brief Bin of the arrival speed if the robot doesn't stop at the end point (see DJ_SOLVER_SPEED_BINS)
+     */
+    uint8_t m_speed_bin;
+    /**
+     * @brief Duration of the path if the robot doesn't stop at the end point
+     */
+    time32_t m_arrival_duration;
+    /**
+     * @brief Arrival speed if the robot doesn't stop at the end point (mm/s)
+     */
+    float m_arrival_speed;
+    /**
+     * @brief Evaluation of the path from the root to this node (duration and end status)
+     */
+    dj_graph_path_evaluation_t m_evaluation;
+    /**
+     * @brief Estimated duration of the fastest path to the goal through this node (see dj_solver_heuristic_t)
+     */
+    time32_t m_estimation;
+    /**
+     * @brief Cost used to order the search (the estimation with the heuristic part weighted by the search weight)
+     */
+    time32_t m_cost;
+    /**
+     * @brief Flag to know if the node has been expanded
+     */
+    bool m_is_finished;
+    /**
+     * @brief Flag to know if a dominating state has replaced this node
+     * @note A superseded node is kept as long as it has children because their paths go through it,
+     *       its slot is reused once it has no more children
+     */
+    bool m_is_superseded;
+    /**
+     * @brief Index of the next search node in the same hash bucket, or in the free slots once released (-1 for none)
+     */
+    int16_t m_next_index;
+} dj_solver_search_node_t;
+
+MAGIC_ARRAY_TYPEDEF(search_node_list, dj_solver_search_node_t, DJ_GRAPH_GRAPH_MAX_PATHS);
+
+/**
+ * @brief Search of a solver
+ * @note The live search states are chained in a hash map by end point,
+ *       so that looking for the states reaching a point doesn't depend on the number of states
+ */
+typedef struct
+{
+    /**
+     * @brief Search nodes (the root is the first one)
+     */
+    search_node_list_t m_nodes;
+    /**
+     * @brief Index of the first search node of each bucket of the hash map (-1 for none)
+     * @note Superseded search nodes aren't in the hash map
+     */
+    int16_t m_buckets[DJ_SOLVER_SEARCH_HASH_BUCKETS];
+    /**
+     * @brief Index of the first released slot of the node list (-1 for none)
+     */
+    int16_t m_free_index;
+    /**
+     * @brief True once the node list has been full : the dominance ignores the bins to keep fewer states
+     * @see DJ_GRAPH_GRAPH_MAX_PATHS
+     */
+    bool m_is_degraded;
+    /**
+     * @brief True if the states reaching the goal don't dominate each other, so that each one ends a path
+     * @note It is false after dj_solver_common_init_nodes
+     */
+    bool m_keep_goal_states;
+    /**
+     * @brief Heuristic used to estimate the duration of the paths to the goal
+     */
+    dj_solver_heuristic_t m_heuristic;
+    /**
+     * @brief Information about the goal used by the heuristic (see dj_solver_heuristic_prepare)
+     */
+    dj_solver_heuristic_data_t *m_heuristic_data;
+    /**
+     * @brief Position of the goal
+     */
+    GEOMETRY_point_t m_goal_position;
+    /**
+     * @brief Other points ending the paths like the goal : their states dominate each other by duration only
+     * @note There is none after dj_solver_common_init_nodes (see dj_solver_dijkstra_solve_targets)
+     */
+    GEOMETRY_point_t m_other_goals[DJ_SOLVER_MAX_TARGETS];
+    /**
+     * @brief Number of other goals
+     */
+    uint8_t m_nb_other_goals;
+    /**
+     * @brief Weight of the heuristic part of the cost (1 : optimal search, > 1 : faster search)
+     * @note The cost of a node is d + weight * (estimation - d), with d the duration until its last segment
+     */
+    float m_weight;
+    /**
+     * @brief The states whose estimation reaches this duration are dropped (UINT32_MAX for no limit)
+     */
+    time32_t m_cost_limit;
+    /**
+     * @brief Number of search nodes expanded with this search since the initialization of the workspace (statistics)
+     * @note It isn't reset by dj_solver_common_init_nodes, so it counts all the searches of a solve
+     */
+    uint32_t m_nb_expansions;
+} dj_solver_search_t;
+
+/**
+ * @brief Memory used by a solver during its solves
+ * @note A workspace is big, it is given to the solvers (see dj_solver_init) to keep them small.
+ *       Two solvers can solve at the same time only with different workspaces.
+ */
+typedef struct
+{
+    /**
+     * @brief Search of the solver
+     */
+    dj_solver_search_t m_search;
+    /**
+     * @brief Information about the goal kept by the heuristics between the solves
+     */
+    dj_solver_heuristic_data_t m_heuristic_data;
+} dj_solver_workspace_t;
 
 /* *********************************************** Public functions declarations ***************************************** */
 
-MAGIC_ARRAY_HEADER(path_list, dj_graph_path_t)
+MAGIC_ARRAY_HEADER(search_node_list, dj_solver_search_node_t)
 
 /**
- * @brief Function to check if a path already goes to the same point in the list
+ * @brief Function to initialize a workspace before its first solve
  *
- * @param list List of path to check
- * @param path Path to check
- * @return int32_t Index of the path in the list, -1 if not found
+ * @param workspace Workspace to initialize
  */
-int32_t dj_graph_solver_index_in_list(path_list_t *list, GEOMETRY_point_t *end_point);
+void dj_solver_common_init_workspace(dj_solver_workspace_t *workspace);
 
 /**
- * @brief Function to initialize the path list
+ * @brief Function to initialize a search with the root node
  *
- * @param path_list List of path to initialize
- * @param current_path Pointer to the current path
- * @param start_status Start status of the path
+ * @param search Search to initialize
+ * @param start_status Start status of the search
+ * @param heuristic Heuristic used to estimate the cost of the search nodes
+ * @param heuristic_data Information about the goal used by the heuristic (see dj_solver_heuristic_prepare)
+ * @param goal_position Position of the goal
+ * @param weight Weight of the heuristic part of the cost (see dj_solver_search_t)
+ * @param cost_limit The states whose estimation reaches this duration are dropped (UINT32_MAX for no limit)
+ * @return int32_t Index of the root node
  */
-void dj_solver_common_init_paths(path_list_t *path_list, dj_graph_path_t **current_path, dj_viewer_status_t *start_status);
+int32_t dj_solver_common_init_nodes(dj_solver_search_t *search,
+                                    dj_viewer_status_t *start_status,
+                                    dj_solver_heuristic_t heuristic,
+                                    dj_solver_heuristic_data_t *heuristic_data,
+                                    GEOMETRY_point_t *goal_position,
+                                    float weight,
+                                    time32_t cost_limit);
 
 /**
- * @brief Function to deinitialize the paths
+ * @brief Function to materialise the path of a search node by walking its parents
  *
- * @param path_list List of path to deinitialize
+ * @param [in] search Search
+ * @param [in] node_index Index of the last search node of the path
+ * @param [out] path Path to build (musn't be initialized)
  */
-void dj_solver_common_deinit_paths(path_list_t *path_list);
+void dj_solver_common_build_path(dj_solver_search_t *search, int32_t node_index, dj_graph_path_t *path);
 
 /**
- * @brief Function to find the next path to explore
+ * @brief Function to know if a point ends the paths of a search (its goal or one of its other goals)
  *
- * @param path_list List of path to explore
- * @param use_heuristic Use the heuristic to find the next path
- * @param goal_position Position of the goal
- * @return dj_graph_path_t* Next path to explore
+ * @param search Search
+ * @param point Point to check
+ * @return bool True if the point is a goal of the search, false otherwise
+ */
+bool dj_solver_common_is_goal(dj_solver_search_t *search, const GEOMETRY_point_t *point);
+
+/**
+ * @brief Function to check if a point is in the path of a search node
+ *
+ * @param search Search
+ * @param node_index Index of the last search node of the path
+ * @param point Point to check
+ * @return bool True if the point is in the path, false otherwise
+ */
+bool dj_solver_common_is_in_path(dj_solver_search_t *search, int32_t node_index, GEOMETRY_point_t *point);
+
+/**
+ * @brief Function to extend a search node to a new position
+ * @note The new state is dropped if another state with the same end point, heading bin and speed bin dominates it,
+ *       whether the robot stops at the end point or not (see DJ_SOLVER_HEADING_BINS). Otherwise the states it
+ *       dominates are superseded. Once the node list is full, the bins are ignored, and the new state is dropped if
+ *       there is still no slot for it.
+ *       Its duration is evaluated incrementally from the evaluation of the parent.
+ *
+ * @param search Search
+ * @param parent_index Index of the search node to extend
+ * @param position Position to reach
+ * @return bool True if the candidate has been added to the list, false otherwise
+ */
+bool dj_solver_common_add_candidate(dj_solver_search_t *search, int32_t parent_index, GEOMETRY_point_t *position);
+
+/**
+ * @brief Function to expand a search node with all the graph nodes reachable from its end
+ * @note The graph is rebuilt from the end status of the search node
+ * @note The search node is finished once expanded
+ *
+ * @param search Search
+ * @param node_index Index of the search node to expand
+ * @param graph_builder Graph builder to rebuild
+ */
+void dj_solver_common_expand_node(dj_solver_search_t *search, int32_t node_index, dj_graph_builder_t *graph_builder);
+
+/**
+ * @brief Function to find the next search node to explore (the one with the lowest estimated cost)
+ *
+ * @param search Search
+ * @return int32_t Index of the next search node to explore, -1 if there is none
+ */
+int32_t dj_solver_common_find_next_node(dj_solver_search_t *search);
+
+/**
+ * @brief Function to get a lower bound of the duration of the paths which can still be found by the search
+ * @note The bound is the lowest estimation of the search nodes to explore,
+ *       it is only valid if the heuristic never overestimates the duration
+ *
+ * @param search Search
+ * @return time32_t Lower bound of the duration (UINT32_MAX if there is no node to explore)
+ */
+time32_t dj_solver_common_get_lower_bound(dj_solver_search_t *search);
+
+/**
+ * @brief Function to get the search node closest to the goal
+ * @note It ends the best partial path when the search is stopped before reaching the goal
+ *
+ * @param search Search
+ * @return int32_t Index of the search node closest to the goal (the fastest one among the closest ones)
+ */
+int32_t dj_solver_common_get_closest_node(dj_solver_search_t *search);
+
+/**
+ * @brief Function to check if a deadline is reached
+ * @note The time can wrap around, the deadline must be less than 2^31 us after the current time
+ *
+ * @param deadline_us Deadline (see dj_dep_get_time_us)
+ * @return bool True if the deadline is reached
  */
-dj_graph_path_t *dj_solver_common_find_next_path(path_list_t *path_list,
-                                                 bool use_heuristic,
-                                                 GEOMETRY_point_t *goal_position);
+bool dj_solver_common_is_deadline_reached(uint32_t deadline_us);
 
 /* ******************************************* Public callback functions declarations ************************************ */
 
@@ -26,23 +26,201 @@
 
 /* ************************************************ Private type definition ********************************************** */
 
-/**
- * @brief list of path generated during the dijkstra algorithm
- * @note This array is global to avoid stack overflow
- */
-static path_list_t path_list;
-
 /* ********************************************* Private functions declarations ****************************************** */
 
+static bool resume_search(dj_solver_dijkstra_t *solver, bool has_deadline, uint32_t deadline_us);
+static void end_search(dj_solver_dijkstra_t *solver);
+static bool is_prebuilt_node(dj_graph_graph_t *graph, const GEOMETRY_point_t *point);
+static dj_graph_node_t *get_extracted_target(dj_solver_search_t *search,
+                                             dj_graph_graph_t *graph,
+                                             const GEOMETRY_point_t *point,
+                                             dj_graph_node_t **extraction_node);
+static void expand_to_target(dj_solver_dijkstra_t *solver,
+                             int32_t node_index,
+                             dj_graph_node_t *extraction_node,
+                             dj_graph_node_t *target_node);
+
 /* ************************************************** Private variables ************************************************** */
 
 /* ********************************************** Private functions definitions ****************************************** */
 
+/**
+ * @brief Function to go on with the search started by dj_solver_dijkstra_begin
+ * @note Each call expands at least one search node, so the search always progresses
+ *
+ * @param solver Pointer to the solver
+ * @param has_deadline True if the search must be stopped at the deadline
+ * @param deadline_us Deadline of the search (see dj_dep_get_time_us)
+ * @return bool True if the search is finished (see end_search)
+ */
+static bool resume_search(dj_solver_dijkstra_t *solver, bool has_deadline, uint32_t deadline_us)
+{
+    dj_solver_search_t *search = &solver->workspace->m_search;
+    uint32_t nb_expansions = 0;
+
+    while (solver->current_index != -1)
+    {
+        // Check the deadline before each expansion
+        if (has_deadline && nb_expansions > 0 && dj_solver_common_is_deadline_reached(deadline_us))
+        {
+            return false;
+        }
+
+        dj_solver_common_expand_node(search, solver->current_index, solver->graph_builder);
+        nb_expansions++;
+        solver->current_index = dj_solver_common_find_next_node(search);
+
+        // The search stops on the first node which reaches the end
+        if (solver->current_index != -1
+            && search_node_list_get(&search->m_nodes, solver->current_index)->m_position.x
+                   == solver->graph_builder->m_graph.end->m_pos.x
+            && search_node_list_get(&search->m_nodes, solver->current_index)->m_position.y
+                   == solver->graph_builder->m_graph.end->m_pos.y)
+        {
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Function to end the search : the solution is built from the search tree
+ *
+ * @param solver Pointer to the solver
+ */
+static void end_search(dj_solver_dijkstra_t *solver)
+{
+    dj_solver_search_t *search = &solver->workspace->m_search;
+
+    // Print all the search nodes generated
+#if DJ_ENABLE_DEBUG_LOGS
+    dj_debug_printf("Genrated search nodes:\n");
+    for (int i = 0; i < search_node_list_size(&search->m_nodes); i++)
+    {
+        dj_solver_search_node_t *search_node = search_node_list_get(&search->m_nodes, i);
+        dj_debug_printf("Node %d: (%d ms) (%d, %d) parent %d\n",
+                        i,
+                        (int)search_node->m_evaluation.m_duration,
+                        search_node->m_position.x,
+                        search_node->m_position.y,
+                        (int)search_node->m_parent_index);
+    }
+#endif
+
+    // The search stops on the solution, its path is built from the search tree
+    if (solver->current_index != -1)
+    {
+        dj_solver_common_build_path(search, solver->current_index, &solver->solution);
+        dj_debug_printf("Solution found\n");
+    }
+    // The solution is built only once
+    solver->current_index = -1;
+}
+
+/**
+ * @brief Function to know if a point is a node of the graph whatever the targets
+ * @note The nodes of the prebuilt graph are before the start node, the end node and the targets are after it
+ *       (see dj_graph_builder_first_rebuild and dj_graph_builder_add_target)
+ *
+ * @param graph Graph after the first rebuild
+ * @param point Point to check
+ * @return bool True if the point is the start point or a node of the prebuilt graph, false otherwise
+ */
+static bool is_prebuilt_node(dj_graph_graph_t *graph, const GEOMETRY_point_t *point)
+{
+    uint32_t start_index = dj_graph_graph_get_index_start(graph);
+    for (uint32_t i = 0; i <= start_index && i < dj_graph_graph_get_num_nodes(graph); i++)
+    {
+        dj_graph_node_t *node = dj_graph_graph_get_node(graph, i);
+        if (node != NULL && node->m_pos.x == point->x && node->m_pos.y == point->y)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Function to get the target of an extraction node added with it
+ * @note A target on an obstacle is linked through an extraction node, added just after it
+ *       (see dj_graph_builder_force_link_node). The nodes of the next rebuilds are after the targets.
+ *
+ * @param search Search (its other goals are the targets added to the graph)
+ * @param graph Graph
+ * @param point Point to check
+ * @param [out] extraction_node Extraction node at the point
+ * @return dj_graph_node_t* Target of the extraction node, NULL if the point isn't an extraction node of a target
+ */
+static dj_graph_node_t *get_extracted_target(dj_solver_search_t *search,
+                                             dj_graph_graph_t *graph,
+                                             const GEOMETRY_point_t *point,
+                                             dj_graph_node_t **extraction_node)
+{
+    dj_graph_node_t *target_node = NULL;
+    for (uint32_t i = dj_graph_graph_get_index_start(graph) + 1; i <= (uint32_t)graph->last_prebuilt_node; i++)
+    {
+        dj_graph_node_t *node = dj_graph_graph_get_node(graph, i);
+        dj_control_non_null(node, NULL);
+        bool is_target = false;
+        for (uint32_t j = 0; j < search->m_nb_other_goals && !is_target; j++)
+        {
+            is_target = node->m_pos.x == search->m_other_goals[j].x && node->m_pos.y == search->m_other_goals[j].y;
+        }
+        if (is_target)
+        {
+            target_node = node;
+        }
+        else if (target_node != NULL && node->m_pos.x == point->x && node->m_pos.y == point->y)
+        {
+            *extraction_node = node;
+            return target_node;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Function to expand a search node on the extraction node of a target : it can only go to this target
+ * @note In a single solve, the extraction node of another target isn't in the graph
+ *
+ * @param solver Pointer to the solver
+ * @param node_index Index of the search node
+ * @param extraction_node Extraction node reached by the search node
+ * @param target_node Target of the extraction node
+ */
+static void expand_to_target(dj_solver_dijkstra_t *solver,
+                             int32_t node_index,
+                             dj_graph_node_t *extraction_node,
+                             dj_graph_node_t *target_node)
+{
+    dj_solver_search_t *search = &solver->workspace->m_search;
+    dj_solver_search_node_t *search_node = search_node_list_get(&search->m_nodes, node_index);
+    dj_control_non_null(search_node, );
+
+    // The links blocked by the dynamic obstacles depend on the status of the search node
+    dj_viewer_status_t status = search_node->m_evaluation.m_end_status;
+    rebuild_graph_with_prebuilt_graph(solver->graph_builder, &status);
+
+    dj_graph_link_t *link
+        = dj_graph_graph_get_link_from_nodes(&solver->graph_builder->m_graph, extraction_node, target_node);
+    if (link != NULL && link->m_enabled)
+    {
+        dj_solver_common_add_candidate(search, node_index, &target_node->m_pos);
+    }
+    search_node->m_is_finished = true;
+}
+
 /* *********************************************** Public functions declarations ***************************************** */
 
-void dj_solver_dijkstra_init(dj_solver_dijkstra_t *solver, dj_graph_builder_t *graph_builder)
+void dj_solver_dijkstra_init(dj_solver_dijkstra_t *solver,
+                             dj_graph_builder_t *graph_builder,
+                             dj_solver_workspace_t *workspace)
 {
-    dj_control_non_null(solver, ) dj_control_non_null(graph_builder, ) solver->graph_builder = graph_builder;
+    dj_control_non_null(solver, ) dj_control_non_null(graph_builder, ) dj_control_non_null(workspace, )
+        solver->graph_builder = graph_builder;
+    solver->workspace = workspace;
+    solver->current_index = -1;
+    solver->is_partial = false;
     // Initialize the solution with invalid values
     dj_viewer_status_t start_status;
     viewer_status_init(&start_status, &(GEOMETRY_point_t){0, 0}, &(GEOMETRY_vector_t){0, 0}, 0);
@@ -61,111 +239,193 @@ void dj_solver_dijkstra_solve(dj_solver_dijkstra_t *solver, dj_viewer_status_t *
         dj_debug_printf("Start of the solve algorithm\n");
     dj_mark_start_time(DJ_MARK_SOLVE);
 
-    dj_graph_path_t *current_path = NULL;
-    bool path_end_reached = false;
+    dj_solver_dijkstra_begin(solver, start_status);
+    resume_search(solver, false, 0);
 
-    dj_solver_common_init_paths(&path_list, &current_path, start_status);
-    dj_control_non_null(current_path, );
+    dj_mark_end_time(DJ_MARK_SOLVE);
+    dj_debug_printf("End of the solve algorithm\n");
+
+    end_search(solver);
+}
+
+void dj_solver_dijkstra_solve_before(dj_solver_dijkstra_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, ) dj_control_non_null(start_status, )
+
+        dj_debug_printf("Start of the solve algorithm before a deadline\n");
+    dj_mark_start_time(DJ_MARK_SOLVE);
+
+    dj_solver_dijkstra_begin(solver, start_status);
+    bool is_finished = resume_search(solver, true, deadline_us);
+
+    dj_mark_end_time(DJ_MARK_SOLVE);
+    dj_debug_printf("End of the solve algorithm before a deadline\n");
+
+    if (!is_finished)
+    {
+        // The best partial path is kept if the end hasn't been reached in time
+        dj_solver_search_t *search = &solver->workspace->m_search;
+        dj_solver_common_build_path(search, dj_solver_common_get_closest_node(search), &solver->solution);
+        dj_debug_printf("No solution found in time, partial path kept\n");
+        solver->current_index = -1;
+        solver->is_partial = true;
+        return;
+    }
+    end_search(solver);
+}
 
-    do
+void dj_solver_dijkstra_begin(dj_solver_dijkstra_t *solver, dj_viewer_status_t *start_status)
+{
+    dj_control_non_null(solver, );
+    dj_control_non_null(start_status, );
+
+    GEOMETRY_point_t goal_position = solver->graph_builder->m_graph.end->m_pos;
+    solver->is_partial = false;
+    solver->current_index = dj_solver_common_init_nodes(&solver->workspace->m_search,
+                                                        start_status,
+                                                        dj_solver_heuristic_none,
+                                                        &solver->workspace->m_heuristic_data,
+                                                        &goal_position,
+                                                        1.0f,
+                                                        UINT32_MAX);
+}
+
+bool dj_solver_dijkstra_step(dj_solver_dijkstra_t *solver, uint32_t deadline_us)
+{
+    dj_control_non_null(solver, true);
+    if (!resume_search(solver, true, deadline_us))
     {
-        dj_viewer_status_t current_status;
-        dj_graph_path_get_end_status(current_path, &current_status);
-        rebuild_graph_with_prebuilt_graph(solver->graph_builder, &current_status);
+        return false;
+    }
+    end_search(solver);
+    return true;
+}
+
+uint32_t dj_solver_dijkstra_solve_targets(dj_solver_dijkstra_t *solver,
+                                          dj_viewer_status_t *start_status,
+                                          const GEOMETRY_point_t *targets,
+                                          uint32_t nb_targets,
+                                          bool has_deadline,
+                                          uint32_t deadline_us,
+                                          time32_t *durations,
+                                          dj_graph_path_t *paths)
+{
+    dj_control_non_null(solver, 0);
+    dj_control_non_null(start_status, 0);
+    dj_control_non_null(targets, 0);
+    dj_control_non_null(durations, 0);
 
-        path_end_reached = true; // Reset path_end_reached for each iteration
+    dj_debug_printf("Start of the solve algorithm for %d targets\n", (int)nb_targets);
+    dj_mark_start_time(DJ_MARK_SOLVE);
 
-        // Get all nodes that are reachable from the end of the current path
-        for (uint32_t link_index = 0; link_index < dj_graph_graph_get_num_links(&solver->graph_builder->m_graph);
-             link_index++)
+    for (uint32_t i = 0; i < nb_targets; i++)
+    {
+        durations[i] = UINT32_MAX;
+        if (paths != NULL)
         {
-            // Get the link
-            dj_graph_link_t *link = dj_graph_graph_get_link(&solver->graph_builder->m_graph, link_index);
+            dj_graph_path_init(&paths[i], start_status);
+        }
+    }
+
+    if (nb_targets > DJ_SOLVER_MAX_TARGETS)
+    {
+        dj_info_printf("DJ : Only the first %d targets are searched\n", DJ_SOLVER_MAX_TARGETS);
+        nb_targets = DJ_SOLVER_MAX_TARGETS;
+    }
 
-            // Check if the link is reachable
-            dj_graph_node_t *node = dj_graph_link_is_connected_to_pos(link, &current_status.m_position);
-            if (node == NULL)
+    // No state reaches the start point again, so the heuristic gives the fastest duration if the robot goes on from
+    // every state : it is a lower bound of the duration of the paths to all the targets
+    dj_solver_search_t *search = &solver->workspace->m_search;
+    int32_t current_index = dj_solver_common_init_nodes(search,
+                                                        start_status,
+                                                        dj_solver_heuristic_none,
+                                                        &solver->workspace->m_heuristic_data,
+                                                        &start_status->m_position,
+                                                        1.0f,
+                                                        UINT32_MAX);
+
+    // The targets added to the graph end the paths as the goal of a single solve : the paths to the other targets
+    // mustn't go through them. The targets which are nodes of the prebuilt graph are crossed as any other node.
+    for (uint32_t i = 0; i < nb_targets; i++)
+    {
+        if (!is_prebuilt_node(&solver->graph_builder->m_graph, &targets[i]))
+        {
+            search->m_other_goals[search->m_nb_other_goals++] = targets[i];
+        }
+    }
+
+    while (current_index != -1)
+    {
+        // The cost of the next state is a lower bound of all the paths left, so a target is settled once its path is
+        // as fast
+        dj_solver_search_node_t *current_node = search_node_list_get(&search->m_nodes, current_index);
+        uint32_t nb_settled_targets = 0;
+        for (uint32_t i = 0; i < nb_targets; i++)
+        {
+            if (durations[i] <= current_node->m_cost)
             {
-                continue;
+                nb_settled_targets++;
             }
+        }
+
+        // Check the deadline before each expansion
+        if (nb_settled_targets == nb_targets || (has_deadline && dj_solver_common_is_deadline_reached(deadline_us)))
+        {
+            break;
+        }
 
-            if (node != NULL && !dj_graph_path_is_in_path(current_path, &node->m_pos) && link->m_enabled)
+        // Keep the fastest path to each target (the robot stops at the target)
+        for (uint32_t i = 0; i < nb_targets; i++)
+        {
+            if (current_node->m_position.x == targets[i].x && current_node->m_position.y == targets[i].y
+                && current_node->m_evaluation.m_duration < durations[i])
             {
-                // Check if the end point is already in the path_list
-                int32_t index_in_list = dj_graph_solver_index_in_list(&path_list, &node->m_pos);
-                if (index_in_list == -1)
-                {
-                    // Add the new path to the list
-                    dj_graph_path_t *new_path_added_to_list = path_list_add(&path_list, NULL);
-                    dj_control_non_null(new_path_added_to_list, ) dj_graph_path_copy(new_path_added_to_list, current_path);
-                    dj_graph_path_add_point(new_path_added_to_list, &node->m_pos);
-                    path_end_reached = false;
-                }
-                else
+                durations[i] = current_node->m_evaluation.m_duration;
+                // The path is built now because the search node may be replaced later
+                if (paths != NULL)
                 {
-                    // Check if the new path is better than the one already in the list
-                    dj_graph_path_t *existing_path = path_list_get(&path_list, index_in_list);
-                    dj_control_non_null(existing_path, ) dj_graph_path_t new_path_to_check;
-                    dj_graph_path_copy(&new_path_to_check, current_path);
-                    dj_graph_path_add_point(&new_path_to_check, &node->m_pos);
-                    if (dj_graph_path_get_duration(&new_path_to_check) < dj_graph_path_get_duration(existing_path))
-                    {
-                        // Replace the existing path with the new one
-                        dj_graph_path_deinit(existing_path);
-                        dj_graph_path_copy(existing_path, &new_path_to_check);
-                        path_end_reached = false;
-                    }
-                    dj_graph_path_deinit(&new_path_to_check);
+                    dj_solver_common_build_path(search, current_index, &paths[i]);
                 }
             }
         }
 
-        // The current path is finished if we have reached any node
-        if (path_end_reached)
+        // A state is expanded only if it can lead to another target (the root is at the goal of the heuristic)
+        bool is_target = current_node->m_parent_index != -1 && dj_solver_common_is_goal(search, &current_node->m_position);
+        dj_graph_node_t *extraction_node = NULL;
+        dj_graph_node_t *target_node = NULL;
+        if (!is_target && !is_prebuilt_node(&solver->graph_builder->m_graph, &current_node->m_position))
         {
-            dj_graph_path_set_as_finished(current_path, true);
+            target_node = get_extracted_target(
+                search, &solver->graph_builder->m_graph, &current_node->m_position, &extraction_node);
         }
-
-        current_path = dj_solver_common_find_next_path(&path_list, false, NULL);
-    } while (current_path != NULL
-             && (current_path->m_end_status.m_position.x != solver->graph_builder->m_graph.end->m_pos.x
-                 || current_path->m_end_status.m_position.y != solver->graph_builder->m_graph.end->m_pos.y));
-
-    dj_mark_end_time(DJ_MARK_SOLVE);
-    dj_debug_printf("End of the solve algorithm\n");
-
-    // Print all the paths generated
-    // Print all the nodes
-#if DJ_ENABLE_DEBUG_LOGS
-    dj_debug_printf("Genrated paths:\n");
-    for (int i = 0; i < path_list_size(&path_list); i++)
-    {
-        dj_graph_path_t *path = path_list_get(&path_list, i);
-        dj_debug_printf("Path %d: (%d ms)", i, (int)dj_graph_path_get_duration(path));
-        for (int j = 0; j < dj_graph_path_get_point_count(path); j++)
+        if (is_target)
         {
-            GEOMETRY_point_t point;
-            dj_graph_path_get_point(path, &point, j);
-            dj_debug_printf("(%d, %d) ", point.x, point.y);
+            current_node->m_is_finished = true;
         }
-        dj_debug_printf("\n");
+        else if (target_node != NULL)
+        {
+            expand_to_target(solver, current_index, extraction_node, target_node);
+        }
+        else
+        {
+            dj_solver_common_expand_node(search, current_index, solver->graph_builder);
+        }
+        current_index = dj_solver_common_find_next_node(search);
     }
-#endif
 
-    // Shearch the solution in the path list
-    for (uint32_t i = 0; i < path_list_size(&path_list); i++)
+    uint32_t nb_reached_targets = 0;
+    for (uint32_t i = 0; i < nb_targets; i++)
     {
-        dj_graph_path_t *path = path_list_get(&path_list, i);
-        dj_control_non_null(path, ) if (path->m_end_status.m_position.x == solver->graph_builder->m_graph.end->m_pos.x
-                                        && path->m_end_status.m_position.y == solver->graph_builder->m_graph.end->m_pos.y)
+        if (durations[i] != UINT32_MAX)
         {
-            dj_graph_path_copy(&solver->solution, path);
-            dj_debug_printf("Solution found\n");
-            break;
+            nb_reached_targets++;
         }
     }
 
-    dj_solver_common_deinit_paths(&path_list);
+    dj_mark_end_time(DJ_MARK_SOLVE);
+    dj_debug_printf("End of the solve algorithm (%d targets reached)\n", (int)nb_reached_targets);
+
+    return nb_reached_targets;
 }
 
 void dj_solver_dijkstra_get_solution(dj_solver_dijkstra_t *solver, dj_graph_path_t *solution)
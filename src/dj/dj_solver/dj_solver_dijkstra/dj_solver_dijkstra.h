@@ -4,6 +4,7 @@
 #include "../../dj_graph/dj_graph_path.h"
 #include "../../dj_graph_builder/dj_graph_builder.h"
 #include "../../dj_viewer/dj_viewer_status.h"
+#include "../dj_solver_common/dj_solver_common.h"
 
 /**
  * @brief Structure to store the solver
@@ -14,10 +15,23 @@ typedef struct
      * @brief Graph builder to use
      */
     dj_graph_builder_t *graph_builder;
+    /**
+     * @brief Memory used during the solves
+     */
+    dj_solver_workspace_t *workspace;
     /**
      * @brief Solution of the solver
      */
     dj_graph_path_t solution;
+    /**
+     * @brief Index of the next search node to explore (-1 if none)
+     */
+    int32_t current_index;
+    /**
+     * @brief True if the solution is a partial path, the solve has been stopped before the end
+     * @see dj_solver_dijkstra_solve_before
+     */
+    bool is_partial;
 } dj_solver_dijkstra_t;
 
 /**
@@ -25,8 +39,11 @@ typedef struct
  *
  * @param solver Pointer to the solver to initialize
  * @param graph_builder Pointer to the graph builder to use
+ * @param workspace Pointer to the memory to use during the solves (it musn't be used by another solver at the same time)
  */
-void dj_solver_dijkstra_init(dj_solver_dijkstra_t *solver, dj_graph_builder_t *graph_builder);
+void dj_solver_dijkstra_init(dj_solver_dijkstra_t *solver,
+                             dj_graph_builder_t *graph_builder,
+                             dj_solver_workspace_t *workspace);
 
 /**
  * @brief Function to deinitialize the solver
@@ -42,6 +59,64 @@ void dj_solver_dijkstra_deinit(dj_solver_dijkstra_t *solver);
  */
 void dj_solver_dijkstra_solve(dj_solver_dijkstra_t *solver, dj_viewer_status_t *start_status);
 
+/**
+ * @brief Function to solve the graph before a deadline
+ * @note If the end isn't reached before the deadline, the solution is the path to the search node closest to the
+ *       end (see dj_solver_common_get_closest_node)
+ *
+ * @param solver Pointer to the solver to solve
+ * @param start_status Start status of the path
+ * @param deadline_us Time at which the solving must be stopped (see dj_dep_get_time_us)
+ */
+void dj_solver_dijkstra_solve_before(dj_solver_dijkstra_t *solver, dj_viewer_status_t *start_status, uint32_t deadline_us);
+
+/**
+ * @brief Function to start a solve done by slices (see dj_solver_dijkstra_step)
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the path
+ */
+void dj_solver_dijkstra_begin(dj_solver_dijkstra_t *solver, dj_viewer_status_t *start_status);
+
+/**
+ * @brief Function to go on with the solve started by dj_solver_dijkstra_begin until a deadline
+ * @note At least one search node is explored by each call, so the solve always progresses
+ * @note The graph and the workspace musn't be used by anything else between the calls
+ *
+ * @param solver Pointer to the solver
+ * @param deadline_us Time at which the slice must be stopped (see dj_dep_get_time_us)
+ * @return bool True if the solve is finished (the solution can be read), false if it must go on
+ */
+bool dj_solver_dijkstra_step(dj_solver_dijkstra_t *solver, uint32_t deadline_us);
+
+/**
+ * @brief Function to find the fastest paths to many targets with a single search
+ * @note The search goes on until the paths to all the targets are settled (or the deadline is reached),
+ *       so a single search replaces one search per target and finds the same paths as long as the search list isn't
+ *       full (see DJ_GRAPH_GRAPH_MAX_PATHS). Each target is a goal : the paths to the other targets don't go through it
+ *       or through its extraction node, unless it is a node of the prebuilt graph.
+ * @pre The targets must be added by dj_graph_builder_add_target after a first rebuild whose end node is the start
+ *      point (see dj_genarate_paths_to_targets)
+ *
+ * @param solver Pointer to the solver
+ * @param start_status Start status of the paths
+ * @param targets Targets to reach
+ * @param nb_targets Number of targets (at least 1, only the first DJ_SOLVER_MAX_TARGETS ones are searched)
+ * @param has_deadline True if the search must be stopped at the deadline
+ * @param deadline_us Deadline of the search (see dj_dep_get_time_us)
+ * @param [out] durations Duration of the fastest path to each target (UINT32_MAX if the target isn't reached)
+ * @param [out] paths Fastest path to each target (can be NULL)
+ * @return uint32_t Number of targets reached
+ */
+uint32_t dj_solver_dijkstra_solve_targets(dj_solver_dijkstra_t *solver,
+                                          dj_viewer_status_t *start_status,
+                                          const GEOMETRY_point_t *targets,
+                                          uint32_t nb_targets,
+                                          bool has_deadline,
+                                          uint32_t deadline_us,
+                                          time32_t *durations,
+                                          dj_graph_path_t *paths);
+
 /**
  * @brief Function to get the solution
  *
@@ -0,0 +1,151 @@
+/**
+ * @file dj_solver_heuristic.c
+ * @brief Heuristics used by the dj solvers to order the search
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_solver_heuristic.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "dj_solver_heuristic.h"
+#include "../../dj_logs/dj_logs.h"
+#include "../../dj_prop_config/dj_prop_config.h"
+
+#include <math.h>
+
+/* **************************************************** Private macros *************************************************** */
+
+/* ************************************************ Private type definition ********************************************** */
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static time32_t get_fastest_duration(const dj_graph_path_evaluation_t *evaluation, uint32_t remaining_distance);
+
+/* ************************************************** Private variables ************************************************** */
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to get the duration of the fastest move through the end of a path and then along a distance
+ *
+ * @param evaluation Evaluation of the path
+ * @param remaining_distance Distance to cover after the end of the path (mm)
+ * @return time32_t Duration of the whole path
+ */
+static time32_t get_fastest_duration(const dj_graph_path_evaluation_t *evaluation, uint32_t remaining_distance)
+{
+    /*
+        The last segment of the path ends immobile, but it is re-evaluated when the path is extended
+        (see dj_graph_path_evaluation_extend). The bound therefore starts at the beginning of the last segment.
+        From there, the robot has to go through the end of the path and then to the goal.
+
+        The fastest way to cover a distance (d) from an initial speed (v0) is to accelerate all along :
+        d = 0.5 * a * t^2 + v0 * t
+        t = (sqrt(v0^2 + 2 * a * d) - v0) / a
+        But t is in ms so :
+        t = 1000 * (sqrt(v0^2 + 2 * a * d) - v0) / a
+    */
+    const dj_viewer_status_t *status = &evaluation->m_last_segment_status;
+    float distance
+        = (float)GEOMETRY_distance(status->m_position, evaluation->m_end_status.m_position) + (float)remaining_distance;
+    float initial_speed = sqrtf((float)status->m_speed.x * status->m_speed.x + (float)status->m_speed.y * status->m_speed.y);
+    float duration = 1000.0f
+                     * (sqrtf(initial_speed * initial_speed + 2.0f * PROP_LINEAR_ACCELERATION * distance) - initial_speed)
+                     / PROP_LINEAR_ACCELERATION;
+
+    return evaluation->m_last_segment_duration + (time32_t)duration;
+}
+
+/* ********************************************** Public functions definitions ******************************************* */
+
+void dj_solver_heuristic_init_data(dj_solver_heuristic_data_t *data)
+{
+    dj_control_non_null(data, );
+    data->m_heuristic = NULL;
+}
+
+void dj_solver_heuristic_prepare(dj_solver_heuristic_t heuristic, dj_solver_heuristic_data_t *data, dj_graph_graph_t *graph)
+{
+    dj_control_non_null(data, );
+    dj_control_non_null(graph, );
+    if (heuristic != data->m_heuristic)
+    {
+        // The information of the previous heuristic shares the same memory
+        data->m_heuristic = heuristic;
+        if (heuristic == dj_solver_heuristic_landmarks)
+        {
+            data->m_instance.m_landmarks.m_is_valid = false;
+        }
+    }
+    if (heuristic == dj_solver_heuristic_landmarks)
+    {
+        dj_solver_landmarks_update(&data->m_instance.m_landmarks, graph);
+    }
+}
+
+time32_t dj_solver_heuristic_none(dj_solver_heuristic_data_t *data,
+                                  const dj_graph_path_evaluation_t *evaluation,
+                                  const GEOMETRY_point_t *goal)
+{
+    // This heuristic doesn't need any information about the goal
+    (void)data;
+    dj_control_non_null(evaluation, 0);
+    dj_control_non_null(goal, 0);
+
+    // The path can't be shortened once the goal is reached
+    const GEOMETRY_point_t *end = &evaluation->m_end_status.m_position;
+    if (end->x == goal->x && end->y == goal->y)
+    {
+        return evaluation->m_duration;
+    }
+
+    // The path isn't over, its last segment may be shortened by going on without stopping
+    return get_fastest_duration(evaluation, 0);
+}
+
+time32_t dj_solver_heuristic_kinematic(dj_solver_heuristic_data_t *data,
+                                       const dj_graph_path_evaluation_t *evaluation,
+                                       const GEOMETRY_point_t *goal)
+{
+    // This heuristic doesn't need any information about the goal
+    (void)data;
+    dj_control_non_null(evaluation, 0);
+    dj_control_non_null(goal, 0);
+
+    // The path can't be shortened once the goal is reached
+    const GEOMETRY_point_t *end = &evaluation->m_end_status.m_position;
+    if (end->x == goal->x && end->y == goal->y)
+    {
+        return evaluation->m_duration;
+    }
+
+    return get_fastest_duration(evaluation, GEOMETRY_distance(*end, *goal));
+}
+
+time32_t dj_solver_heuristic_landmarks(dj_solver_heuristic_data_t *data,
+                                       const dj_graph_path_evaluation_t *evaluation,
+                                       const GEOMETRY_point_t *goal)
+{
+    dj_control_non_null(data, 0);
+    dj_control_non_null(evaluation, 0);
+    dj_control_non_null(goal, 0);
+
+    // The path can't be shortened once the goal is reached
+    const GEOMETRY_point_t *end = &evaluation->m_end_status.m_position;
+    if (end->x == goal->x && end->y == goal->y)
+    {
+        return evaluation->m_duration;
+    }
+
+    // The lower bounds are only known if the solve has been prepared for this heuristic
+    uint32_t remaining_distance = GEOMETRY_distance(*end, *goal);
+    if (data->m_heuristic == dj_solver_heuristic_landmarks)
+    {
+        remaining_distance
+            = MAX(remaining_distance, dj_solver_landmarks_get_lower_bound(&data->m_instance.m_landmarks, end, goal));
+    }
+    return get_fastest_duration(evaluation, remaining_distance);
+}
+
+/* ***************************************** Public callback functions definitions *************************************** */
@@ -0,0 +1,121 @@
+/**
+ * @file dj_solver_heuristic.h
+ * @brief Heuristics used by the dj solvers to order the search
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_solver_heuristic.c
+ */
+
+#ifndef __DJ_SOLVER_HEURISTIC_H__
+#define __DJ_SOLVER_HEURISTIC_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../../dj_dependencies/dj_dependencies.h"
+#include "../../dj_graph/dj_graph_graph.h"
+#include "../../dj_graph/dj_graph_path.h"
+#include "../dj_solver_landmarks/dj_solver_landmarks.h"
+
+/* ***************************************************** Public macros *************************************************** */
+
+/* ************************************************** Public types definition ******************************************** */
+
+/**
+ * @brief Information kept by the heuristics about the goal of the solves (see dj_solver_heuristic_data)
+ */
+typedef struct dj_solver_heuristic_data dj_solver_heuristic_data_t;
+
+/**
+ * @brief Function to estimate the duration of the fastest path which extends a path up to the goal (f-cost)
+ * @note The estimation must never be greater than the real duration for the A* solver to return optimal paths.
+ *       When the path already ends at the goal, the estimation must be the duration of the path.
+ *
+ * @param data Information about the goal (see dj_solver_heuristic_prepare)
+ * @param evaluation Evaluation of the path to extend
+ * @param goal Position of the goal
+ * @return time32_t Estimated duration of the whole path up to the goal
+ */
+typedef time32_t (*dj_solver_heuristic_t)(dj_solver_heuristic_data_t *data,
+                                          const dj_graph_path_evaluation_t *evaluation,
+                                          const GEOMETRY_point_t *goal);
+
+/**
+ * @brief Information kept by the heuristics about the goal of the solves
+ * @note Each solver workspace has its own data, so the solves of different planners don't share it
+ * @note Only the information of the heuristic of the last prepared solve is kept
+ */
+struct dj_solver_heuristic_data
+{
+    /**
+     * @brief Heuristic of the information (NULL if no solve has been prepared)
+     */
+    dj_solver_heuristic_t m_heuristic;
+    /**
+     * @brief Information of the heuristic (only the one of m_heuristic is used)
+     */
+    union
+    {
+        /**
+         * @brief Lower bounds to the goal of dj_solver_heuristic_landmarks
+         */
+        dj_solver_landmarks_t m_landmarks;
+    } m_instance;
+};
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+/**
+ * @brief Function to initialize the information of the heuristics (nothing is known about the goal)
+ *
+ * @param data Information to initialize
+ */
+void dj_solver_heuristic_init_data(dj_solver_heuristic_data_t *data);
+
+/**
+ * @brief Function to prepare a heuristic for a new solve
+ * @note Some heuristics keep information about the goal of the solve (see dj_solver_landmarks_update).
+ *       The information of the previous heuristic is dropped when the heuristic changes.
+ *
+ * @param heuristic Heuristic used by the solve
+ * @param data Information about the goal to prepare
+ * @param graph Graph of the solve (with its start and end nodes)
+ */
+void dj_solver_heuristic_prepare(dj_solver_heuristic_t heuristic, dj_solver_heuristic_data_t *data, dj_graph_graph_t *graph);
+
+/**
+ * @brief Heuristic which doesn't estimate the remaining distance (used by Dijkstra)
+ * @note The cost is the duration of the path if the robot doesn't stop at the end of its last segment, which is a
+ *       lower bound of the duration of its extensions
+ * @see dj_solver_heuristic_t
+ */
+time32_t dj_solver_heuristic_none(dj_solver_heuristic_data_t *data,
+                                  const dj_graph_path_evaluation_t *evaluation,
+                                  const GEOMETRY_point_t *goal);
+
+/**
+ * @brief Heuristic based on the fastest possible move to the goal
+ * @note The robot is considered to accelerate with PROP_LINEAR_ACCELERATION from its entry speed along the
+ *       straight line distance to the goal, without rotation nor braking.
+ * @warning The bound holds as long as braking to stop isn't faster than keeping accelerating,
+ *          which is the case with the propulsion configuration of dj_prop_config.h
+ * @see dj_solver_heuristic_t
+ */
+time32_t dj_solver_heuristic_kinematic(dj_solver_heuristic_data_t *data,
+                                       const dj_graph_path_evaluation_t *evaluation,
+                                       const GEOMETRY_point_t *goal);
+
+/**
+ * @brief Heuristic based on the fastest possible move to the goal along a lower bound of the shortest path given by
+ *        the landmarks of the prebuilt graph
+ * @note Same as dj_solver_heuristic_kinematic, but the straight line distance to the goal is replaced by the
+ *       lower bound of the landmarks when it is greater (see dj_solver_landmarks_update).
+ *       Nothing is searched when the goal changes.
+ * @see dj_solver_heuristic_t
+ */
+time32_t dj_solver_heuristic_landmarks(dj_solver_heuristic_data_t *data,
+                                       const dj_graph_path_evaluation_t *evaluation,
+                                       const GEOMETRY_point_t *goal);
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
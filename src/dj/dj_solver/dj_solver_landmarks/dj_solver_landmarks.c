@@ -0,0 +1,146 @@
+/**
+ * @file dj_solver_landmarks.c
+ * @brief Lower bounds of the distances to the goal given by the landmarks of the prebuilt graph (ALT)
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_solver_landmarks.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "dj_solver_landmarks.h"
+#include "../../dj_graph/dj_graph_link.h"
+#include "../../dj_graph_builder/dj_prebuilt_graph.h"
+#include "../../dj_logs/dj_logs.h"
+
+#include <stdbool.h>
+
+/* **************************************************** Private macros *************************************************** */
+
+/* ************************************************ Private type definition ********************************************** */
+
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static void add_goal_neighbor(dj_solver_landmarks_t *landmarks,
+                              const GEOMETRY_point_t *neighbor_position,
+                              uint32_t distance);
+
+/* ************************************************** Private variables ************************************************** */
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Function to take into account a path from the goal to a prebuilt node
+ *
+ * @param landmarks Distances of the landmarks to update
+ * @param neighbor_position Position of the node (nothing is done if it isn't prebuilt)
+ * @param distance Length of the path between the goal and the node (mm)
+ */
+static void add_goal_neighbor(dj_solver_landmarks_t *landmarks,
+                              const GEOMETRY_point_t *neighbor_position,
+                              uint32_t distance)
+{
+    const uint32_t *neighbor_distances = dj_prebuilt_graph_get_landmark_distances(neighbor_position);
+    if (neighbor_distances == NULL)
+    {
+        return;
+    }
+    for (uint32_t landmark = 0; landmark < DJ_PREBUILT_NB_LANDMARKS; landmark++)
+    {
+        if (neighbor_distances[landmark] != UINT32_MAX)
+        {
+            landmarks->m_distances[landmark]
+                = MIN(landmarks->m_distances[landmark], neighbor_distances[landmark] + distance);
+        }
+    }
+    landmarks->m_is_valid = true;
+}
+
+/* ********************************************** Public functions definitions ******************************************* */
+
+void dj_solver_landmarks_update(dj_solver_landmarks_t *landmarks, dj_graph_graph_t *graph)
+{
+    dj_control_non_null(landmarks, );
+    dj_control_non_null(graph, );
+    dj_control_non_null(graph->end, );
+
+    GEOMETRY_point_t *goal = &graph->end->m_pos;
+    landmarks->m_goal = *goal;
+    landmarks->m_is_valid = false;
+    for (uint32_t landmark = 0; landmark < DJ_PREBUILT_NB_LANDMARKS; landmark++)
+    {
+        landmarks->m_distances[landmark] = UINT32_MAX;
+    }
+
+    // The goal can be a prebuilt node
+    add_goal_neighbor(landmarks, goal, 0);
+    if (landmarks->m_is_valid)
+    {
+        return;
+    }
+
+    // Else the paths to the goal go through the nodes it is linked to (or through the node which extracts it)
+    uint32_t nb_links = dj_graph_graph_get_num_links(graph);
+    for (uint32_t link_index = 0; link_index < nb_links; link_index++)
+    {
+        dj_graph_node_t *neighbor = dj_graph_link_is_connected_to_pos(dj_graph_graph_get_link(graph, link_index), goal);
+        if (neighbor == NULL || !neighbor->m_enabled || neighbor == graph->start)
+        {
+            continue;
+        }
+        uint32_t neighbor_distance = GEOMETRY_distance(*goal, neighbor->m_pos);
+        if (dj_prebuilt_graph_get_landmark_distances(&neighbor->m_pos) != NULL)
+        {
+            add_goal_neighbor(landmarks, &neighbor->m_pos, neighbor_distance);
+            continue;
+        }
+        for (uint32_t via_link_index = 0; via_link_index < nb_links; via_link_index++)
+        {
+            dj_graph_node_t *via_neighbor
+                = dj_graph_link_is_connected_to_pos(dj_graph_graph_get_link(graph, via_link_index), &neighbor->m_pos);
+            if (via_neighbor != NULL && via_neighbor->m_enabled && via_neighbor != graph->start)
+            {
+                add_goal_neighbor(landmarks,
+                                  &via_neighbor->m_pos,
+                                  neighbor_distance + GEOMETRY_distance(neighbor->m_pos, via_neighbor->m_pos));
+            }
+        }
+    }
+}
+
+uint32_t dj_solver_landmarks_get_lower_bound(const dj_solver_landmarks_t *landmarks,
+                                             const GEOMETRY_point_t *position,
+                                             const GEOMETRY_point_t *goal)
+{
+    dj_control_non_null(landmarks, 0);
+    dj_control_non_null(position, 0);
+    dj_control_non_null(goal, 0);
+
+    if (!landmarks->m_is_valid || landmarks->m_goal.x != goal->x || landmarks->m_goal.y != goal->y)
+    {
+        return 0;
+    }
+    const uint32_t *distances = dj_prebuilt_graph_get_landmark_distances(position);
+    if (distances == NULL)
+    {
+        return 0;
+    }
+
+    uint32_t lower_bound = 0;
+    for (uint32_t landmark = 0; landmark < DJ_PREBUILT_NB_LANDMARKS; landmark++)
+    {
+        // A landmark which doesn't reach both nodes doesn't give any bound
+        if (distances[landmark] == UINT32_MAX || landmarks->m_distances[landmark] == UINT32_MAX)
+        {
+            continue;
+        }
+        uint32_t difference = (distances[landmark] > landmarks->m_distances[landmark])
+                                  ? distances[landmark] - landmarks->m_distances[landmark]
+                                  : landmarks->m_distances[landmark] - distances[landmark];
+        lower_bound = MAX(lower_bound, difference);
+    }
+    return lower_bound;
+}
+
+/* ***************************************** Public callback functions definitions *************************************** */
@@ -0,0 +1,62 @@
+/**
+ * @file dj_solver_landmarks.h
+ * @brief Lower bounds of the distances to the goal given by the landmarks of the prebuilt graph (ALT)
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_solver_landmarks.c
+ */
+
+#ifndef __DJ_SOLVER_LANDMARKS_H__
+#define __DJ_SOLVER_LANDMARKS_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "../../dj_dependencies/dj_dependencies.h"
+#include "../../dj_graph/dj_graph_graph.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/* ************************************************** Public types definition ******************************************** */
+
+/**
+ * @brief Distances from the landmarks to the goal of the current solve
+ */
+typedef struct
+{
+    uint32_t m_distances[DJ_PREBUILT_NB_LANDMARKS > 0 ? DJ_PREBUILT_NB_LANDMARKS : 1];
+    GEOMETRY_point_t m_goal;
+    bool m_is_valid;
+} dj_solver_landmarks_t;
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+/**
+ * @brief Function to compute the distances from the landmarks to the goal of a new solve
+ * @note The goal is linked to the prebuilt nodes it sees, its distances are deduced from theirs
+ *       (see dj_prebuilt_graph_get_landmark_distances)
+ *
+ * @param landmarks Distances of the landmarks to update
+ * @param graph Graph of the solve (with its start and end nodes)
+ */
+void dj_solver_landmarks_update(dj_solver_landmarks_t *landmarks, dj_graph_graph_t *graph);
+
+/**
+ * @brief Function to get a lower bound of the length of the shortest path from a graph node to the goal
+ * @note For each landmark L, the triangle inequality gives d(node, goal) >= |d(L, goal) - d(L, node)|
+ *
+ * @param landmarks Distances of the landmarks (see dj_solver_landmarks_update)
+ * @param position Position of the graph node
+ * @param goal Position of the goal
+ * @return uint32_t Lower bound of the length (mm), 0 if the node isn't prebuilt or if the goal isn't the one of the
+ *         last update
+ */
+uint32_t dj_solver_landmarks_get_lower_bound(const dj_solver_landmarks_t *landmarks,
+                                             const GEOMETRY_point_t *position,
+                                             const GEOMETRY_point_t *goal);
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif
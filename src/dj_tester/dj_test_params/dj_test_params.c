@@ -35,7 +35,7 @@ bool dj_test_params_start_test(const dj_test_params_t *params)
     pos_simulator_set_position(params->m_start_point);
     // Generate the path to the destination point
     dj_graph_path_t path;
-    return dj_genarate_path_with_param(&path, params->m_destination_point, true);
+    return dj_genarate_path_with_param(NULL, &path, params->m_destination_point, true, NULL);
 }
 
 /* ***************************************** Public callback functions definitions *************************************** */
\ No newline at end of file
@@ -0,0 +1,1146 @@
+/**
+ * @file dj_test_scenarios.c
+ * @brief Scenarios of the DJ module, with a known expected result
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_test_scenarios.h
+ */
+
+/* ******************************************************* Includes ****************************************************** */
+#include "dj_test_scenarios.h"
+#include "dj/dj_dependencies/dj_dependencies.h"
+#include "dj/dj_launcher/dj_launcher.h"
+#include "dj/dj_launcher/dj_plan_cache.h"
+#include "dj/dj_launcher/dj_planner_service.h"
+#include "dj/dj_obstacle/dj_obstacle_dynamic.h"
+#include "dj/dj_obstacle/dj_obstacle_manager.h"
+#include "dj/dj_obstacle/dj_quartic.h"
+#include "dj/dj_obstacle_importer/dj_obstacle_importer.h"
+#include "pos_simulator/pos_simulator.h"
+
+#include <math.h>
+#include <stdio.h>
+
+/* **************************************************** Private macros *************************************************** */
+
+/**
+ * @brief Maximum duration of the wait for a path published by the planner service
+ */
+#define SERVICE_TIMEOUT_US 10000000 // us
+
+/**
+ * @brief Sampling step of the scenario of the quartic polynomials
+ */
+#define QUARTIC_STEP 0.01f // s
+
+/**
+ * @brief Relative tolerance of the check of the signs of the quartic polynomials
+ * @note Near a root, the rounding of the float evaluations (fused or not) can give the opposite sign
+ */
+#define SIGN_CHECK_TOLERANCE 1e-5
+
+/**
+ * @brief Maximum number of alternative paths asked by the scenarios
+ */
+#define MAX_ALTERNATIVE_PATHS 3
+
+/**
+ * @brief Number of targets of the scenario of the paths to many targets
+ */
+#define NB_TARGETS 6
+
+/**
+ * @brief Budget of the scenario of the tight budget, too small to find a path
+ */
+#define TIGHT_BUDGET_US 1000 // us
+
+/**
+ * @brief Maximum duration of a query of the scenario of the tight budget (the building of the graph and the path of
+ *        the prebuilt table are done after the deadline)
+ */
+#define TIGHT_BUDGET_MAX_US 10000 // us
+
+/* ************************************************ Private type definition ********************************************** */
+
+/**
+ * @brief Structure representing a scenario
+ */
+typedef struct
+{
+    const char *m_name;   /**< Name of the scenario */
+    bool (*m_run)(void); /**< Function running the scenario, it returns true on success */
+} scenario_t;
+
+/**
+ * @brief Structure representing a dynamic obstacle met, or not, by the viewer on a segment
+ */
+typedef struct
+{
+    GEOMETRY_vector_t m_viewer_speed;       /**< Speed of the viewer at the beginning of the segment */
+    GEOMETRY_point_t m_obstacle_position;   /**< Initial position of the obstacle */
+    GEOMETRY_vector_t m_obstacle_speed;     /**< Initial speed of the obstacle */
+    GEOMETRY_vector_t m_obstacle_acceleration; /**< Acceleration of the obstacle */
+    bool m_is_blocked;                     /**< True if the obstacle must block the segment */
+} segment_case_t;
+
+/* ********************************************* Private functions declarations ****************************************** */
+
+static bool get_duration(GEOMETRY_point_t start_point,
+                         GEOMETRY_point_t destination_point,
+                         const dj_planner_config_t *config,
+                         time32_t *duration);
+static bool is_same_path(dj_graph_path_t *path, dj_graph_path_t *expected_path);
+static bool run_fastest_path_regression(void);
+static bool run_heuristic_independence(void);
+static bool run_alternative_paths(void);
+static bool run_paths_to_targets(void);
+static bool run_tight_budget(void);
+static bool get_weighted_duration(GEOMETRY_point_t start_point,
+                                  GEOMETRY_point_t destination_point,
+                                  float epsilon,
+                                  time32_t *duration,
+                                  uint32_t *nb_expansions);
+static bool run_weighted_astar(void);
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS) && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+static bool run_full_dynamic_obstacle_pool(void);
+static bool run_blocked_only_route(void);
+#endif
+static bool run_continuous_segment_check(void);
+static bool check_quartic_signs(dj_quartic_t *quartic, dj_quartic_roots_t *roots, float step);
+static bool run_quartic_signs(void);
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+static bool wait_service_result(uint32_t start_us, uint32_t previous_sequence);
+static bool run_planner_service(void);
+#endif
+#if DJ_ENABLE_PLAN_CACHE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+static bool is_cached(GEOMETRY_point_t target_point, const char *description, bool is_expected);
+static bool run_plan_cache(void);
+#endif
+
+/* ************************************************** Private variables ************************************************** */
+
+/**
+ * @brief Path of the scenarios
+ * @note It is global to avoid stack overflow
+ */
+static dj_graph_path_t scenario_path;
+
+/**
+ * @brief Alternative paths of the scenarios
+ * @note It is global to avoid stack overflow
+ */
+static dj_graph_path_t alternative_paths[MAX_ALTERNATIVE_PATHS];
+
+/**
+ * @brief Paths to many targets of the scenarios
+ * @note It is global to avoid stack overflow
+ */
+static dj_graph_path_t target_paths[NB_TARGETS];
+
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS) && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Obstacle manager of the scenarios
+ * @note It is global to avoid stack overflow
+ */
+static dj_obstacle_manager_t scenario_manager;
+#endif
+
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Path published by the planner service
+ * @note It is global to avoid stack overflow
+ */
+static dj_planner_service_result_t service_result;
+
+/**
+ * @brief Path of the blocking query compared to the path published by the planner service
+ * @note It is global to avoid stack overflow
+ */
+static dj_graph_path_t expected_service_path;
+#endif
+
+/**
+ * @brief Planner of the scenario of the weighted A*, its search counts the expanded search nodes
+ * @note It is global to avoid stack overflow
+ */
+static dj_planner_t weighted_planner;
+
+/**
+ * @brief Scenarios to run
+ */
+static const scenario_t scenarios[] = {
+    {"fastest path regression", run_fastest_path_regression},
+    {"heuristic independence", run_heuristic_independence},
+    {"alternative paths", run_alternative_paths},
+    {"paths to many targets", run_paths_to_targets},
+    {"tight budget", run_tight_budget},
+    {"weighted A*", run_weighted_astar},
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS) && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    {"full dynamic obstacle pool", run_full_dynamic_obstacle_pool},
+    {"only route blocked by a dynamic obstacle", run_blocked_only_route},
+#endif
+    {"continuous segment check", run_continuous_segment_check},
+    {"quartic signs", run_quartic_signs},
+#if DJ_ENABLE_PLAN_CACHE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    {"plan cache", run_plan_cache},
+#endif
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+    {"planner service", run_planner_service},
+#endif
+};
+
+/* ********************************************** Private functions definitions ****************************************** */
+
+/**
+ * @brief Compute the duration of the fastest path between two points
+ * @param start_point Start point of the path
+ * @param destination_point Destination point of the path
+ * @param config Configuration of the planner (NULL for the default one)
+ * @param duration Duration of the path
+ * @return true if a path has been found, false otherwise
+ */
+static bool get_duration(GEOMETRY_point_t start_point,
+                         GEOMETRY_point_t destination_point,
+                         const dj_planner_config_t *config,
+                         time32_t *duration)
+{
+    pos_simulator_set_position(start_point);
+    if (!dj_genarate_path_with_param(NULL, &scenario_path, destination_point, true, config))
+    {
+        return false;
+    }
+    *duration = dj_graph_path_get_duration(&scenario_path);
+    return true;
+}
+
+/**
+ * @brief Check if two paths have the same points and the same duration
+ * @param path Path to check
+ * @param expected_path Expected path
+ * @return true if the paths are the same
+ */
+static bool is_same_path(dj_graph_path_t *path, dj_graph_path_t *expected_path)
+{
+    uint32_t nb_points = dj_graph_path_get_point_count(path);
+    if (nb_points != dj_graph_path_get_point_count(expected_path)
+        || dj_graph_path_get_duration(path) != dj_graph_path_get_duration(expected_path))
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < nb_points; i++)
+    {
+        GEOMETRY_point_t point;
+        GEOMETRY_point_t expected_point;
+        dj_graph_path_get_point(path, &point, i);
+        dj_graph_path_get_point(expected_path, &expected_point, i);
+        if (point.x != expected_point.x || point.y != expected_point.y)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check that the fastest paths aren't lost by the dominance of the search states
+ * @note With 4 heading bins and 4 speed bins, the path from (1119, 2600) to (1509, 382) lasted 7378 ms instead of
+ *       6730 ms. With 1 heading bin and no speed bin, the two other paths lasted 13012 ms and 6691 ms.
+ * @return true if the paths are at least as fast as the expected ones
+ */
+static bool run_fastest_path_regression(void)
+{
+    static const struct
+    {
+        GEOMETRY_point_t m_start;       /**< Start point of the path */
+        GEOMETRY_point_t m_destination; /**< Destination point of the path */
+        time32_t m_max_duration;        /**< Maximum duration of the path */
+    } cases[] = {
+        {{1119, 2600}, {1509, 382}, 6730},
+        {{1510, 2540}, {371, 1709}, 12023},
+        {{1403, 1471}, {326, 719}, 6550},
+    };
+
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        time32_t duration;
+        if (!get_duration(cases[i].m_start, cases[i].m_destination, NULL, &duration))
+        {
+            printf("No path from (%d, %d) to (%d, %d)\n",
+                   cases[i].m_start.x,
+                   cases[i].m_start.y,
+                   cases[i].m_destination.x,
+                   cases[i].m_destination.y);
+            success = false;
+        }
+        else if (duration > cases[i].m_max_duration)
+        {
+            printf("Path from (%d, %d) to (%d, %d) lasts %d ms instead of at most %d ms\n",
+                   cases[i].m_start.x,
+                   cases[i].m_start.y,
+                   cases[i].m_destination.x,
+                   cases[i].m_destination.y,
+                   (int)duration,
+                   (int)cases[i].m_max_duration);
+            success = false;
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Check that the heuristics and the solvers give the same duration without tolerance
+ * @note The durations changed with the heuristic when the dominance of the search states depended on the order of
+ *       the expansions
+ * @return true if all the durations are the ones of the Dijkstra solver
+ */
+static bool run_heuristic_independence(void)
+{
+    static const GEOMETRY_point_t points[][2] = {
+        {{1119, 2600}, {1509, 382}},
+        {{1625, 803}, {1669, 2168}},
+        {{450, 2045}, {926, 674}},
+        {{1108, 928}, {300, 1604}},
+    };
+    static const dj_solver_heuristic_t heuristics[] = {
+        dj_solver_heuristic_none,
+        dj_solver_heuristic_kinematic,
+        dj_solver_heuristic_landmarks,
+    };
+
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(points) / sizeof(points[0]); i++)
+    {
+        dj_planner_config_t config;
+        dj_planner_config_init(&config);
+        config.m_epsilon = 0.0f;
+        config.m_solver = dj_solver_get_vtable(DJ_SOLVER_TYPE_DIJKSTRA);
+        time32_t expected_duration;
+        if (!get_duration(points[i][0], points[i][1], &config, &expected_duration))
+        {
+            return false;
+        }
+
+        config.m_solver = dj_solver_get_vtable(DJ_SOLVER_TYPE_ASTAR);
+        for (uint32_t j = 0; j < sizeof(heuristics) / sizeof(heuristics[0]); j++)
+        {
+            config.m_heuristic = heuristics[j];
+            time32_t duration = 0;
+            if (!get_duration(points[i][0], points[i][1], &config, &duration) || duration != expected_duration)
+            {
+                printf("Path from (%d, %d) to (%d, %d) with the heuristic %d lasts %d ms instead of %d ms\n",
+                       points[i][0].x,
+                       points[i][0].y,
+                       points[i][1].x,
+                       points[i][1].y,
+                       (int)j,
+                       (int)duration,
+                       (int)expected_duration);
+                success = false;
+            }
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Check that the alternative paths search returns several distinct paths, from the fastest to the slowest
+ * @note The search returned only the fastest path when the states reaching the goal dominated each other
+ * @return true if each query returns more than one distinct path and the first one is the fastest
+ */
+static bool run_alternative_paths(void)
+{
+    static const GEOMETRY_point_t points[][2] = {
+        {{1119, 2600}, {1509, 382}},
+        {{1625, 803}, {1669, 2168}},
+        {{1510, 2540}, {371, 1709}},
+        {{1403, 1471}, {326, 719}},
+        {{1108, 928}, {300, 1604}},
+    };
+
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(points) / sizeof(points[0]); i++)
+    {
+        time32_t fastest_duration;
+        if (!get_duration(points[i][0], points[i][1], NULL, &fastest_duration))
+        {
+            return false;
+        }
+        uint32_t nb_paths
+            = dj_genarate_alternative_paths(NULL, alternative_paths, MAX_ALTERNATIVE_PATHS, points[i][1], true);
+        if (nb_paths < 2 || dj_graph_path_get_duration(&alternative_paths[0]) != fastest_duration)
+        {
+            printf("Path from (%d, %d) to (%d, %d) : %d alternative paths, the first one lasts %d ms instead of %d ms\n",
+                   points[i][0].x,
+                   points[i][0].y,
+                   points[i][1].x,
+                   points[i][1].y,
+                   (int)nb_paths,
+                   (int)(nb_paths > 0 ? dj_graph_path_get_duration(&alternative_paths[0]) : 0),
+                   (int)fastest_duration);
+            success = false;
+        }
+        for (uint32_t j = 1; j < nb_paths; j++)
+        {
+            if (is_same_path(&alternative_paths[j], &alternative_paths[j - 1])
+                || dj_graph_path_get_duration(&alternative_paths[j]) < dj_graph_path_get_duration(&alternative_paths[j - 1]))
+            {
+                printf("Alternative path %d from (%d, %d) to (%d, %d) isn't distinct or is faster than the previous one\n",
+                       (int)j,
+                       points[i][0].x,
+                       points[i][0].y,
+                       points[i][1].x,
+                       points[i][1].y);
+                success = false;
+            }
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Check that a single search to many targets gives the same durations as one search per target
+ * @note The durations differed when only the first target was a goal : the other targets were crossed by the paths
+ *       and their states were compared as the ones of any other node
+ * @return true if each target has the duration of its own search
+ */
+static bool run_paths_to_targets(void)
+{
+    static const GEOMETRY_point_t start_point = {1119, 2600};
+    static const GEOMETRY_point_t targets[NB_TARGETS] = {
+        {1509, 382},
+        {1625, 803},
+        {1669, 2168},
+        {371, 1709},
+        {326, 719},
+        {926, 674},
+    };
+
+    pos_simulator_set_position(start_point);
+    time32_t durations[NB_TARGETS];
+    uint32_t nb_reached_targets = dj_genarate_paths_to_targets(NULL, targets, NB_TARGETS, true, 0, durations, target_paths);
+
+    bool success = true;
+    for (uint32_t i = 0; i < NB_TARGETS; i++)
+    {
+        time32_t expected_duration = UINT32_MAX;
+        if (!get_duration(start_point, targets[i], NULL, &expected_duration))
+        {
+            expected_duration = UINT32_MAX;
+        }
+        time32_t path_duration = durations[i] == UINT32_MAX ? UINT32_MAX : dj_graph_path_get_duration(&target_paths[i]);
+        if (durations[i] != expected_duration || path_duration != expected_duration)
+        {
+            printf("Path from (%d, %d) to (%d, %d) lasts %d ms (path of %d ms) instead of %d ms\n",
+                   start_point.x,
+                   start_point.y,
+                   targets[i].x,
+                   targets[i].y,
+                   (int)durations[i],
+                   (int)path_duration,
+                   (int)expected_duration);
+            success = false;
+        }
+    }
+    if (nb_reached_targets != NB_TARGETS)
+    {
+        printf("%d targets reached instead of %d\n", (int)nb_reached_targets, NB_TARGETS);
+        success = false;
+    }
+    return success;
+}
+
+/**
+ * @brief Check that a path is returned within a budget too small to find one
+ * @note With a budget of 1 ms, the first greedy search was stopped before reaching the target and no path was
+ *       returned
+ * @return true if each query returns a path to the target and lasts at most TIGHT_BUDGET_MAX_US
+ */
+static bool run_tight_budget(void)
+{
+    static const GEOMETRY_point_t points[][2] = {
+        {{1119, 2600}, {1509, 382}},
+        {{1510, 2540}, {371, 1709}},
+        {{1625, 803}, {1669, 2168}},
+    };
+
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(points) / sizeof(points[0]); i++)
+    {
+        pos_simulator_set_position(points[i][0]);
+        uint32_t start_us;
+        uint32_t end_us;
+        dj_dep_get_time_us(&start_us);
+        bool is_found = dj_genarate_path_with_budget(NULL, &scenario_path, points[i][1], true, TIGHT_BUDGET_US, NULL);
+        dj_dep_get_time_us(&end_us);
+
+        GEOMETRY_point_t end_point;
+        dj_graph_path_get_end(&scenario_path, &end_point);
+        if (!is_found || end_point.x != points[i][1].x || end_point.y != points[i][1].y)
+        {
+            printf("No path from (%d, %d) to (%d, %d) with a budget of %d us\n",
+                   points[i][0].x,
+                   points[i][0].y,
+                   points[i][1].x,
+                   points[i][1].y,
+                   TIGHT_BUDGET_US);
+            success = false;
+        }
+        if (end_us - start_us > TIGHT_BUDGET_MAX_US)
+        {
+            printf("Path from (%d, %d) to (%d, %d) computed in %d us instead of at most %d us\n",
+                   points[i][0].x,
+                   points[i][0].y,
+                   points[i][1].x,
+                   points[i][1].y,
+                   (int)(end_us - start_us),
+                   TIGHT_BUDGET_MAX_US);
+            success = false;
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Compute the duration of a path found by the A* solver with a tolerance
+ * @param start_point Start point of the path
+ * @param destination_point Destination point of the path
+ * @param epsilon Tolerance of the solver (see dj_solver_set_epsilon)
+ * @param duration Duration of the path
+ * @param nb_expansions Number of search nodes expanded by all the searches of the solve
+ * @return true if a path has been found, false otherwise
+ */
+static bool get_weighted_duration(GEOMETRY_point_t start_point,
+                                  GEOMETRY_point_t destination_point,
+                                  float epsilon,
+                                  time32_t *duration,
+                                  uint32_t *nb_expansions)
+{
+    dj_planner_config_t config;
+    dj_planner_config_init(&config);
+    config.m_solver = dj_solver_get_vtable(DJ_SOLVER_TYPE_ASTAR);
+    config.m_epsilon = epsilon;
+
+    uint32_t previous_nb_expansions = weighted_planner.m_workspace.m_search.m_nb_expansions;
+    pos_simulator_set_position(start_point);
+    if (!dj_genarate_path_with_param(&weighted_planner, &scenario_path, destination_point, true, &config))
+    {
+        return false;
+    }
+    *duration = dj_graph_path_get_duration(&scenario_path);
+    *nb_expansions = weighted_planner.m_workspace.m_search.m_nb_expansions - previous_nb_expansions;
+    return true;
+}
+
+/**
+ * @brief Check that the tolerance of the A* solver bounds the duration of the path and saves work on some queries
+ * @note The weighted search is certified by a second search when its bound isn't within the tolerance. With the
+ *       kinematic heuristic, it is the case of most queries, so the tolerance can expand more search nodes.
+ * @return true if the durations are within the tolerance of the Dijkstra solver and the expected queries expand
+ *         fewer search nodes than without tolerance
+ */
+static bool run_weighted_astar(void)
+{
+    static const struct
+    {
+        GEOMETRY_point_t m_start;       /**< Start point of the path */
+        GEOMETRY_point_t m_destination; /**< Destination point of the path */
+        float m_epsilon;                /**< Tolerance of the solver */
+        bool m_saves_expansions;        /**< True if fewer search nodes must be expanded than without tolerance */
+    } cases[] = {
+        {{1625, 803}, {1669, 2168}, 0.2f, true},
+        {{1625, 803}, {1669, 2168}, 1.0f, true},
+        {{1108, 928}, {300, 1604}, 0.5f, true},
+        {{1119, 2600}, {1509, 382}, 0.5f, false},
+        {{1403, 1471}, {326, 719}, 0.2f, false},
+        {{450, 2045}, {926, 674}, 1.0f, false},
+    };
+
+    dj_planner_init(&weighted_planner);
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        dj_planner_config_t config;
+        dj_planner_config_init(&config);
+        config.m_solver = dj_solver_get_vtable(DJ_SOLVER_TYPE_DIJKSTRA);
+        time32_t fastest_duration;
+        time32_t exact_duration;
+        time32_t duration;
+        uint32_t exact_nb_expansions;
+        uint32_t nb_expansions;
+        if (!get_duration(cases[i].m_start, cases[i].m_destination, &config, &fastest_duration)
+            || !get_weighted_duration(
+                cases[i].m_start, cases[i].m_destination, 0.0f, &exact_duration, &exact_nb_expansions)
+            || !get_weighted_duration(
+                cases[i].m_start, cases[i].m_destination, cases[i].m_epsilon, &duration, &nb_expansions))
+        {
+            printf("No path from (%d, %d) to (%d, %d)\n",
+                   cases[i].m_start.x,
+                   cases[i].m_start.y,
+                   cases[i].m_destination.x,
+                   cases[i].m_destination.y);
+            success = false;
+            continue;
+        }
+
+        if ((float)duration > (1.0f + cases[i].m_epsilon) * (float)fastest_duration)
+        {
+            printf("Path from (%d, %d) to (%d, %d) with the tolerance %d/100 lasts %d ms instead of at most %d ms\n",
+                   cases[i].m_start.x,
+                   cases[i].m_start.y,
+                   cases[i].m_destination.x,
+                   cases[i].m_destination.y,
+                   (int)(cases[i].m_epsilon * 100),
+                   (int)duration,
+                   (int)((1.0f + cases[i].m_epsilon) * (float)fastest_duration));
+            success = false;
+        }
+        if (cases[i].m_saves_expansions && nb_expansions >= exact_nb_expansions)
+        {
+            printf("Path from (%d, %d) to (%d, %d) with the tolerance %d/100 expands %d search nodes instead of "
+                   "less than %d\n",
+                   cases[i].m_start.x,
+                   cases[i].m_start.y,
+                   cases[i].m_destination.x,
+                   cases[i].m_destination.y,
+                   (int)(cases[i].m_epsilon * 100),
+                   (int)nb_expansions,
+                   (int)exact_nb_expansions);
+            success = false;
+        }
+    }
+    dj_planner_deinit(&weighted_planner);
+    return success;
+}
+
+#if (DJ_DYNAMIC_OBSTACLE_MODE == DJ_DYNAMIC_OBSTACLE_MODE_SOLUTIONS) && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Check that the obstacle manager keeps all the positions of a full pool of dynamic obstacles
+ * @note Each obstacle of the pool can have several positions, the last ones were ignored when the manager was full
+ * @return true if the manager contains all the positions of all the obstacles
+ */
+static bool run_full_dynamic_obstacle_pool(void)
+{
+    dj_polygon_t shape = {.nb_points = 4, .points = {{-50, -50}, {50, -50}, {50, 50}, {-50, 50}}};
+    dj_dynamic_obstacle_handle_t handles[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    dj_obstacle_dynamic_t *obstacles[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    dj_viewer_status_t viewer = {.m_position = {1500, 1500}, .m_speed = {0, 0}, .m_time = 0};
+
+    // Obstacles crossing in front of the viewer, most of them have 2 positions
+    uint16_t nb_obstacles = 0;
+    for (uint16_t i = 0; i < DJ_DYNAMIC_OBSTACLE_POOL_SIZE; i++)
+    {
+        handles[i] = dj_obstacle_importer_add_pooled_dynamic_obstacle(&shape, true);
+        if (handles[i] == DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE)
+        {
+            break;
+        }
+        nb_obstacles++;
+        GEOMETRY_point_t position = {1800 + 20 * i, 1400 + (i % 4) * 60};
+        GEOMETRY_vector_t speed = {0, (i % 2) ? -200 : 200};
+        GEOMETRY_vector_t acceleration = {0, 0};
+        dj_obstacle_importer_refresh_pooled_dynamic_obstacle(handles[i], &acceleration, &speed, &position);
+    }
+
+    // Positions expected in the manager
+    uint16_t nb_pooled_obstacles = dj_obstacle_importer_get_pooled_dynamic_obstacle_count();
+    for (uint16_t i = 0; i < nb_pooled_obstacles; i++)
+    {
+        obstacles[i] = dj_obstacle_importer_get_pooled_dynamic_obstacle(i);
+    }
+    dj_dynamic_polygon_solution_t solutions[DJ_DYNAMIC_OBSTACLE_POOL_SIZE];
+    dj_obstacle_dynamic_get_positions(obstacles, nb_pooled_obstacles, &viewer, solutions);
+    uint32_t nb_positions = 0;
+    for (uint16_t i = 0; i < nb_pooled_obstacles; i++)
+    {
+        nb_positions += solutions[i].m_nb_solutions;
+    }
+
+    dj_obstacle_manager_init(&scenario_manager);
+    uint32_t nb_static_obstacles
+        = static_obstacles_list_size(dj_obstacle_manager_get_all_obstacles(&scenario_manager, NULL));
+    uint32_t nb_computed_obstacles
+        = static_obstacles_list_size(dj_obstacle_manager_get_all_obstacles(&scenario_manager, &viewer));
+    dj_obstacle_manager_deinit(&scenario_manager);
+
+    for (uint16_t i = 0; i < nb_obstacles; i++)
+    {
+        dj_obstacle_importer_remove_pooled_dynamic_obstacle(handles[i]);
+    }
+
+    // The pool must be full and have more positions than obstacles to check the size of the manager
+    if (nb_obstacles != DJ_DYNAMIC_OBSTACLE_POOL_SIZE || nb_positions <= DJ_DYNAMIC_OBSTACLE_POOL_SIZE
+        || nb_computed_obstacles != nb_static_obstacles + nb_positions)
+    {
+        printf("%d dynamic obstacles, %d positions expected, %d positions in the obstacle manager\n",
+               (int)nb_obstacles,
+               (int)nb_positions,
+               (int)(nb_computed_obstacles - nb_static_obstacles));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check that the path is searched again without the dynamic obstacles when one of them blocks the only route
+ * @note The retry is done by the blocking queries and by the queries done by slices (see dj_plan_begin)
+ * @return true if the path is only found with the retry
+ */
+static bool run_blocked_only_route(void)
+{
+    // Wall across the whole field, between the start and the target
+    dj_polygon_t shape = {.nb_points = 4, .points = {{-5000, -50}, {5000, -50}, {5000, 50}, {-5000, 50}}};
+    GEOMETRY_point_t start_point = {1000, 1000};
+    GEOMETRY_point_t target_point = {1000, 2000};
+    dj_dynamic_obstacle_handle_t handle = dj_obstacle_importer_add_pooled_dynamic_obstacle(&shape, true);
+    if (handle == DJ_DYNAMIC_OBSTACLE_INVALID_HANDLE)
+    {
+        return false;
+    }
+    GEOMETRY_point_t position = {1000, 1500};
+    GEOMETRY_vector_t speed = {0, 0};
+    GEOMETRY_vector_t acceleration = {0, 0};
+    dj_obstacle_importer_refresh_pooled_dynamic_obstacle(handle, &acceleration, &speed, &position);
+    pos_simulator_set_position(start_point);
+
+    bool is_found_without_retry = dj_genarate_path(NULL, &scenario_path, target_point, false);
+    bool is_found_with_retry = dj_genarate_path(NULL, &scenario_path, target_point, true);
+    dj_plan_begin(NULL, target_point, true, true, NULL);
+    while (dj_plan_step(NULL, 1000) != DJ_PLAN_STATUS_DONE)
+    {
+    }
+    bool is_found_by_slices = dj_plan_result(NULL, &scenario_path);
+
+    dj_obstacle_importer_remove_pooled_dynamic_obstacle(handle);
+
+    if (is_found_without_retry || !is_found_with_retry || !is_found_by_slices)
+    {
+        printf("Path from (%d, %d) to (%d, %d) %sfound without retry, %sfound with retry, %sfound by slices\n",
+               start_point.x,
+               start_point.y,
+               target_point.x,
+               target_point.y,
+               is_found_without_retry ? "" : "not ",
+               is_found_with_retry ? "" : "not ",
+               is_found_by_slices ? "" : "not ");
+        return false;
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief Check the validation of a segment against a dynamic obstacle in DJ_DYNAMIC_OBSTACLE_MODE_CONTINUOUS
+ * @note The viewer which starts on an obstacle was never blocked, even if the obstacle met it again later
+ * @note The viewer which has to stop and rotate before following the segment was considered as leaving at once
+ * @return true if each segment is blocked as expected
+ */
+static bool run_continuous_segment_check(void)
+{
+    static const segment_case_t cases[] = {
+        // Obstacle crossing the segment while the viewer passes
+        {{0, 0}, {1500, 375}, {0, 250}, {0, 0}, true},
+        // Obstacle crossing the segment after the viewer has passed
+        {{0, 0}, {1200, 200}, {0, 200}, {0, 0}, false},
+        // Viewer starting on an obstacle which moves away
+        {{0, 0}, {1000, 1000}, {-300, 0}, {0, 0}, false},
+        // Viewer starting on an obstacle which comes back and overtakes it
+        {{0, 0}, {1000, 1000}, {-200, 0}, {300, 0}, true},
+        // Obstacle crossing the start of the segment while the viewer stops and rotates
+        {{0, 300}, {1100, 460}, {0, 200}, {0, 0}, true},
+    };
+    dj_polygon_t shape = {.nb_points = 4, .points = {{-50, -50}, {50, -50}, {50, 50}, {-50, 50}}};
+    GEOMETRY_point_t target = {2000, 1000};
+
+    bool success = true;
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        dj_obstacle_dynamic_t obstacle;
+        GEOMETRY_point_t position = cases[i].m_obstacle_position;
+        GEOMETRY_vector_t speed = cases[i].m_obstacle_speed;
+        GEOMETRY_vector_t acceleration = cases[i].m_obstacle_acceleration;
+        dj_obstacle_dynamic_init(&obstacle, &shape, &position, &speed, &acceleration, DYNAMIC_OBSTACLE_POOLED_ID, true);
+        dj_viewer_status_t viewer = {.m_position = {1000, 1000}, .m_speed = cases[i].m_viewer_speed, .m_time = 0};
+        bool is_blocked = dj_obstacle_dynamic_is_segment_blocked(&obstacle, &viewer, &target);
+        dj_obstacle_dynamic_deinit(&obstacle);
+
+        if (is_blocked != cases[i].m_is_blocked)
+        {
+            printf("Segment %d is %s instead of %s\n",
+                   (int)i,
+                   is_blocked ? "blocked" : "free",
+                   cases[i].m_is_blocked ? "blocked" : "free");
+            success = false;
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Check the signs given by the roots of a quartic polynomial against a scalar evaluation in double precision
+ * @note The sign of a sample is the sign of e toggled at each root before it. The samples too close to a root to have
+ *       a reliable sign in float are ignored, as the samples after the last root when all the roots are found.
+ * @param quartic Polynomial evaluated on [m_start_time ; m_end_time[
+ * @param roots Roots of the polynomial found by dj_quartic_find_roots
+ * @param step Sampling step
+ * @return true if all the signs are the ones of the scalar evaluation, false otherwise
+ */
+static bool check_quartic_signs(dj_quartic_t *quartic, dj_quartic_roots_t *roots, float step)
+{
+    if (quartic->m_end_time <= quartic->m_start_time)
+    {
+        return roots->m_nb_roots == 0;
+    }
+    uint32_t nb_samples = (uint32_t)ceilf((quartic->m_end_time - quartic->m_start_time) / step);
+
+    bool sign = quartic->m_e > 0;
+    uint8_t root = 0;
+    for (uint32_t sample = 0; sample < nb_samples; sample++)
+    {
+        double t = quartic->m_start_time + sample * (double)step;
+        // A root is a sample time computed in float, so it is compared with half a step of margin
+        while (root < roots->m_nb_roots && roots->m_roots[root] < t + step / 2)
+        {
+            sign = !sign;
+            root++;
+        }
+        if (root == DJ_QUARTIC_MAX_ROOTS)
+        {
+            // The search stops at the last root
+            break;
+        }
+
+        double p = (((quartic->m_a * t + quartic->m_b) * t + quartic->m_c) * t + quartic->m_d) * t + quartic->m_e;
+        // Magnitude of the terms, the rounding errors are proportional to it
+        double abs_t = fabs(t);
+        double magnitude = fabs(quartic->m_a) * abs_t;
+        magnitude = (magnitude + fabs(quartic->m_b)) * abs_t;
+        magnitude = (magnitude + fabs(quartic->m_c)) * abs_t;
+        magnitude = (magnitude + fabs(quartic->m_d)) * abs_t + fabs(quartic->m_e);
+        if (fabs(p) > SIGN_CHECK_TOLERANCE * magnitude && sign != (p > 0))
+        {
+            printf("Sign at %f is wrong\n", t);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check the roots of the quartic polynomials found by the SIMD kernel against a scalar evaluation
+ * @note Without SIMD (see DJ_ENABLE_SIMD), the scalar kernel is checked
+ * @return true if all the signs given by the roots are the ones of the scalar evaluation
+ */
+static bool run_quartic_signs(void)
+{
+    static dj_quartic_t quartics[] = {
+        // Simple roots 0.5, 1.2, 2.7 and 3.9
+        {1.0f, -8.3f, 22.35f, -21.861f, 6.318f, 0.0f, 5.0f},
+        // Close roots 0.05 and 0.06, then 4 and 4.5
+        {-250.0f, 2152.5f, -4734.5f, 501.375f, -13.5f, 0.0f, 5.0f},
+        // Double root 1.5, then 6 and 9, from a start time which isn't a multiple of the step
+        {40.0f, -720.0f, 4050.0f, -7830.0f, 4860.0f, 0.73f, 10.0f},
+        // Square distance between a moving viewer and an obstacle minus the square of a radius (mm, s)
+        {0.0f, 0.0f, 250000.0f, -1200000.0f, 1400000.0f, 0.0f, 15.0f},
+        // Accelerating obstacle, large coefficients over the whole lifetime of an obstacle
+        {10000.0f, -200000.0f, 1500000.0f, -4000000.0f, 9000000.0f, 0.0f, 15.0f},
+        // No root
+        {1.0f, 0.0f, 3.0f, 0.0f, 2.0f, 0.0f, 3.0f},
+    };
+
+    static dj_quartic_roots_t roots[sizeof(quartics) / sizeof(quartics[0])];
+
+    dj_quartic_find_roots(quartics, roots, sizeof(quartics) / sizeof(quartics[0]), QUARTIC_STEP);
+    bool success = true;
+    for (uint16_t i = 0; i < sizeof(quartics) / sizeof(quartics[0]); i++)
+    {
+        if (!check_quartic_signs(&quartics[i], &roots[i], QUARTIC_STEP))
+        {
+            printf("Roots of the quartic %d are wrong\n", (int)i);
+            success = false;
+        }
+    }
+    return success;
+}
+
+#if DJ_ENABLE_PLANNER_SERVICE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Wait for a new path published by the planner service, planned from a given time
+ * @note The service is processed by slices while waiting (it does nothing with DJ_ENABLE_PLANNER_SERVICE_THREAD)
+ * @param start_us The planning of the path must have started after this time (see dj_dep_get_time_us)
+ * @param previous_sequence The number of the path must be greater
+ * @return true if a path has been read in service_result, false after SERVICE_TIMEOUT_US
+ */
+static bool wait_service_result(uint32_t start_us, uint32_t previous_sequence)
+{
+    uint32_t begin_us;
+    dj_dep_get_time_us(&begin_us);
+    uint32_t now_us = begin_us;
+    while (now_us - begin_us < SERVICE_TIMEOUT_US)
+    {
+        dj_planner_service_process(1000);
+        if (dj_planner_service_get_result(&service_result) && service_result.m_sequence > previous_sequence
+            && (int32_t)(service_result.m_timestamp_us - start_us) >= 0)
+        {
+            return true;
+        }
+        dj_dep_get_time_us(&now_us);
+    }
+    printf("No path published by the planner service after the path %d\n", (int)previous_sequence);
+    return false;
+}
+
+/**
+ * @brief Check the paths published by the planner service against the blocking queries
+ * @note It runs in the mode of the build : by a thread with DJ_ENABLE_PLANNER_SERVICE_THREAD, by slices otherwise
+ *       (see linux_slices_preset)
+ * @return true if the published paths are the ones of dj_genarate_path, before and after a change of the obstacles
+ */
+static bool run_planner_service(void)
+{
+    GEOMETRY_point_t start_point = {1119, 2600};
+    GEOMETRY_point_t target_point = {1509, 382};
+    pos_simulator_set_position(start_point);
+    if (!dj_genarate_path(NULL, &expected_service_path, target_point, true))
+    {
+        return false;
+    }
+
+    uint32_t start_us;
+    dj_dep_get_time_us(&start_us);
+    if (!dj_planner_service_start())
+    {
+        return false;
+    }
+    dj_planner_service_set_target(target_point, true);
+
+    // Several paths go through the three slots, each one must be whole
+    bool success = true;
+    uint32_t sequence = 0;
+    for (uint8_t i = 0; success && i < 4; i++)
+    {
+        success = wait_service_result(start_us, sequence) && service_result.m_is_found
+                  && is_same_path(&service_result.m_path, &expected_service_path);
+        sequence = service_result.m_sequence;
+    }
+    if (!success)
+    {
+        printf("Path %d of the planner service isn't the path of dj_genarate_path\n", (int)sequence);
+    }
+
+    // The age of a path grows with the time
+    uint32_t age_us = dj_planner_service_get_age_us(&service_result);
+    uint32_t now_us;
+    dj_dep_get_time_us(&now_us);
+    if (success && (age_us > now_us - start_us || dj_planner_service_get_age_us(&service_result) < age_us))
+    {
+        printf("Path of the planner service is %d us old, %d us after the start\n", (int)age_us, (int)(now_us - start_us));
+        success = false;
+    }
+
+    // The obstacles are modified during a planning : the path in progress musn't be published
+    // (by slices, it is planned again, with the thread, the lock waits for its end)
+    GEOMETRY_point_t first_point;
+    dj_graph_path_get_point(&expected_service_path, &first_point, 1);
+    dj_polygon_t shape = {.nb_points = 4, .points = {{-100, -100}, {100, -100}, {100, 100}, {-100, 100}}};
+    GEOMETRY_point_t position = {(start_point.x + first_point.x) / 2, (start_point.y + first_point.y) / 2};
+    GEOMETRY_vector_t speed = {0, 0};
+    GEOMETRY_vector_t acceleration = {0, 0};
+    dj_planner_service_set_target(target_point, true);
+    dj_planner_service_process(1);
+    uint32_t lock_us;
+    dj_dep_get_time_us(&lock_us);
+    dj_planner_service_lock();
+    dj_dynamic_obstacle_handle_t handle = dj_obstacle_importer_add_pooled_dynamic_obstacle(&shape, true);
+    dj_obstacle_importer_refresh_pooled_dynamic_obstacle(handle, &acceleration, &speed, &position);
+    dj_planner_service_unlock();
+
+    success = success && wait_service_result(lock_us, sequence);
+#if !DJ_ENABLE_PLANNER_SERVICE_THREAD
+    if (success && service_result.m_sequence != sequence + 1)
+    {
+        printf("Path %d of the planner service has been published before the new obstacles\n", (int)sequence + 1);
+        success = false;
+    }
+#endif
+    if (success)
+    {
+        time32_t duration = dj_graph_path_get_duration(&expected_service_path);
+        if (!dj_genarate_path(NULL, &expected_service_path, target_point, true)
+            || dj_graph_path_get_duration(&expected_service_path) == duration
+            || !is_same_path(&service_result.m_path, &expected_service_path))
+        {
+            printf("Path of the planner service isn't the path of dj_genarate_path with the new obstacles\n");
+            success = false;
+        }
+    }
+
+    dj_planner_service_clear_target();
+    dj_planner_service_lock();
+    dj_obstacle_importer_remove_pooled_dynamic_obstacle(handle);
+    dj_planner_service_unlock();
+    dj_planner_service_stop();
+    return success;
+}
+#endif
+
+#if DJ_ENABLE_PLAN_CACHE && DJ_ENABLE_DYNAMIC_OBSTACLE_POOL
+/**
+ * @brief Check if the cache has an up to date path to a target
+ * @param target_point Target of the path
+ * @param description Description of the state of the robot and of the obstacles
+ * @param is_expected True if the path must be found in the cache
+ * @return true if the path is found in the cache as expected
+ */
+static bool is_cached(GEOMETRY_point_t target_point, const char *description, bool is_expected)
+{
+    bool is_found = dj_plan_cache_get_path(target_point, &scenario_path);
+    if (is_found != is_expected)
+    {
+        printf("Path to (%d, %d) %sfound in the cache %s\n",
+               target_point.x,
+               target_point.y,
+               is_found ? "" : "not ",
+               description);
+    }
+    return is_found == is_expected;
+}
+
+/**
+ * @brief Check the hits and the misses of the cache of the precomputed paths
+ * @note A path precomputed at rest was returned to a moving robot, with the time of its precomputation, and a path
+ *       precomputed long before was returned because its age was measured with another clock, even with dynamic
+ *       obstacles which had moved since
+ * @return true if the cache returns the paths only when they are up to date
+ */
+static bool run_plan_cache(void)
+{
+    GEOMETRY_point_t start_point = {1119, 2600};
+    GEOMETRY_point_t target_points[] = {{1509, 382}, {1625, 803}};
+    GEOMETRY_point_t other_target_point = {1669, 2168};
+
+    // Duration of the path computed without the cache (it isn't used with a configuration)
+    dj_planner_config_t config;
+    dj_planner_config_init(&config);
+    time32_t expected_duration;
+    if (!get_duration(start_point, target_points[0], &config, &expected_duration))
+    {
+        return false;
+    }
+
+    dj_plan_cache_set_targets(target_points, sizeof(target_points) / sizeof(target_points[0]));
+    while (dj_plan_cache_process(1000))
+    {
+    }
+
+    bool success = is_cached(target_points[0], "after the precomputation", true);
+    if (success && dj_graph_path_get_duration(&scenario_path) != expected_duration)
+    {
+        printf("Path from the cache lasts %d ms instead of %d ms\n",
+               (int)dj_graph_path_get_duration(&scenario_path),
+               (int)expected_duration);
+        success = false;
+    }
+    success = success && is_cached(target_points[1], "after the precomputation", true)
+              && is_cached(other_target_point, "for a target which isn't registered", false);
+
+    // The path is computed for the speed of the robot
+    pos_simulator_set_speed((GEOMETRY_vector_t){300, 0});
+    success = success && is_cached(target_points[0], "with another speed", false);
+    pos_simulator_set_speed((GEOMETRY_vector_t){0, 0});
+    success = success && is_cached(target_points[0], "with the speed of the precomputation", true);
+
+    // The path gets too old with the time of the robot
+    pos_simulator_set_time(DJ_PLAN_CACHE_MAX_AGE_MS + 1);
+    success = success && is_cached(target_points[0], "after its maximum age", false);
+
+    // The path is evaluated from the current time and starts from the current position of the robot
+    time32_t time = DJ_PLAN_CACHE_MAX_AGE_MS / 2;
+    GEOMETRY_point_t moved_start_point = {start_point.x + DJ_PLAN_CACHE_MAX_START_DISTANCE / 2, start_point.y};
+    pos_simulator_set_time(time);
+    pos_simulator_set_position(moved_start_point);
+    success = success && is_cached(target_points[0], "later", true);
+    dj_viewer_status_t init_status;
+    dj_graph_path_get_init_status(&scenario_path, &init_status);
+    GEOMETRY_point_t first_point;
+    dj_graph_path_get_point(&scenario_path, &first_point, 0);
+    if (success
+        && (init_status.m_time != time || !GEOMETRY_point_compare(init_status.m_position, moved_start_point)
+            || !GEOMETRY_point_compare(first_point, moved_start_point)))
+    {
+        printf("Path from the cache starts from (%d, %d) at %d ms instead of (%d, %d) at %d ms\n",
+               first_point.x,
+               first_point.y,
+               (int)init_status.m_time,
+               moved_start_point.x,
+               moved_start_point.y,
+               (int)time);
+        success = false;
+    }
+    pos_simulator_set_position(start_point);
+    pos_simulator_set_time(0);
+
+    // The paths aren't used while a dynamic obstacle may meet the robot, it moves even if it isn't refreshed
+    dj_polygon_t moving_shape = {.nb_points = 4, .points = {{-50, -50}, {50, -50}, {50, 50}, {-50, 50}}};
+    GEOMETRY_point_t position = {300, 300};
+    GEOMETRY_vector_t speed = {0, 0};
+    GEOMETRY_vector_t acceleration = {0, 0};
+    dj_dynamic_obstacle_handle_t moving_handle = dj_obstacle_importer_add_pooled_dynamic_obstacle(&moving_shape, true);
+    dj_obstacle_importer_refresh_pooled_dynamic_obstacle(moving_handle, &acceleration, &speed, &position);
+    while (dj_plan_cache_process(1000))
+    {
+    }
+    success = success && is_cached(target_points[0], "with a dynamic obstacle which may be met", false);
+    position = (GEOMETRY_point_t){-5000, -5000};
+    dj_obstacle_importer_refresh_pooled_dynamic_obstacle(moving_handle, &acceleration, &speed, &position);
+    while (dj_plan_cache_process(1000))
+    {
+    }
+    success = success && is_cached(target_points[0], "with a dynamic obstacle out of reach", true);
+    dj_obstacle_importer_remove_pooled_dynamic_obstacle(moving_handle);
+
+    // The paths are precomputed again when the obstacles change
+    dj_polygon_t shape = {.nb_points = 4, .points = {{-50, -50}, {50, -50}, {50, 50}, {-50, 50}}};
+    dj_dynamic_obstacle_handle_t handle = dj_obstacle_importer_add_pooled_dynamic_obstacle(&shape, true);
+    success = success && is_cached(target_points[0], "after a change of the obstacles", false);
+    dj_obstacle_importer_remove_pooled_dynamic_obstacle(handle);
+    while (dj_plan_cache_process(1000))
+    {
+    }
+    success = success && is_cached(target_points[0], "after a new precomputation", true);
+
+    dj_plan_cache_set_targets(NULL, 0);
+    return success;
+}
+#endif
+
+/* ********************************************** Public functions definitions ******************************************* */
+
+uint32_t dj_test_scenarios_run(dj_test_report_t *report)
+{
+    uint32_t nb_scenarios = sizeof(scenarios) / sizeof(scenarios[0]);
+    uint32_t nb_failed = 0;
+    for (uint32_t i = 0; i < nb_scenarios; i++)
+    {
+        bool success = scenarios[i].m_run();
+        if (!success)
+        {
+            nb_failed++;
+        }
+
+        char l_result[DJ_TEST_REPORT_MAX_LENGTH];
+        snprintf(l_result, DJ_TEST_REPORT_MAX_LENGTH, "Scenario %s : %s\n", scenarios[i].m_name, success ? "OK" : "FAILED");
+        dj_test_report_add_message(report, l_result);
+    }
+
+    char l_result[DJ_TEST_REPORT_MAX_LENGTH];
+    snprintf(l_result,
+             DJ_TEST_REPORT_MAX_LENGTH,
+             "Scenarios : %d/%d passed\n",
+             (int)(nb_scenarios - nb_failed),
+             (int)nb_scenarios);
+    dj_test_report_add_message(report, l_result);
+    return nb_failed;
+}
+
+/* ***************************************** Public callback functions definitions *************************************** */
@@ -0,0 +1,36 @@
+/**
+ * @file dj_test_scenarios.h
+ * @brief Scenarios of the DJ module, with a known expected result
+ * @author Cyprien Ménard
+ * @date 10/2026
+ * @see dj_test_scenarios.c
+ */
+
+#ifndef __DJ_TEST_SCENARIOS_H__
+#define __DJ_TEST_SCENARIOS_H__
+
+/* ******************************************************* Includes ****************************************************** */
+
+#include "dj_tester/dj_test_report/dj_test_report.h"
+
+#include <stdint.h>
+
+/* ***************************************************** Public macros *************************************************** */
+
+/* ************************************************** Public types definition ******************************************** */
+
+/* *********************************************** Public functions declarations ***************************************** */
+
+/**
+ * @brief Run all the scenarios of the DJ module
+ *
+ * The scenarios check the results which the random tests can't check (regressions, ...).
+ *
+ * @param report Pointer to the test report to fill with the results
+ * @return Number of failed scenarios
+ */
+uint32_t dj_test_scenarios_run(dj_test_report_t *report);
+
+/* ******************************************* Public callback functions declarations ************************************ */
+
+#endif /* __DJ_TEST_SCENARIOS_H__ */
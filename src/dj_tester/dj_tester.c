@@ -8,6 +8,7 @@
 
 /* ******************************************************* Includes ****************************************************** */
 #include "dj_tester.h"
+#include "dj_test_scenarios/dj_test_scenarios.h"
 #include "point_generator/point_generator.h"
 
 /* **************************************************** Private macros *************************************************** */
@@ -68,6 +69,8 @@ void dj_tester_launch_tests()
     // Generate a report of the test results
     dj_test_report_t l_report;
     dj_test_get_report(&test_set, &l_report);
+    // Run the scenarios with a known expected result
+    dj_test_scenarios_run(&l_report);
     // Print the report
     dj_test_report_print(&l_report);
     // Save the report to a file
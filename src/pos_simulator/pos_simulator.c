@@ -17,6 +17,8 @@
 
 /* ************************************************** Private variables ************************************************** */
 static GEOMETRY_point_t g_robot_position;
+static GEOMETRY_vector_t g_robot_speed;
+static time32_t g_robot_time;
 
 /* ********************************************** Private functions definitions ****************************************** */
 
@@ -32,4 +34,24 @@ GEOMETRY_point_t pos_simulator_get_position()
     return g_robot_position;
 }
 
+void pos_simulator_set_speed(GEOMETRY_vector_t speed)
+{
+    g_robot_speed = speed;
+}
+
+GEOMETRY_vector_t pos_simulator_get_speed()
+{
+    return g_robot_speed;
+}
+
+void pos_simulator_set_time(time32_t time)
+{
+    g_robot_time = time;
+}
+
+time32_t pos_simulator_get_time()
+{
+    return g_robot_time;
+}
+
 /* ***************************************** Public callback functions definitions *************************************** */
\ No newline at end of file
@@ -12,6 +12,7 @@
 /* ******************************************************* Includes ****************************************************** */
 
 #include "dj/dj_dependencies/QS_maths/QS_maths.h"
+#include "dj/dj_dependencies/QS_types.h"
 
 /* ***************************************************** Public macros *************************************************** */
 
@@ -31,6 +32,30 @@ void pos_simulator_set_position(GEOMETRY_point_t position);
  */
 GEOMETRY_point_t pos_simulator_get_position();
 
+/**
+ * @brief Set the speed of the robot in the simulator
+ * @param speed The speed to set (mm/s)
+ */
+void pos_simulator_set_speed(GEOMETRY_vector_t speed);
+
+/**
+ * @brief Get the current speed of the robot in the simulator
+ * @return The current speed of the robot (mm/s)
+ */
+GEOMETRY_vector_t pos_simulator_get_speed();
+
+/**
+ * @brief Set the time of the robot in the simulator
+ * @param time The time to set (ms)
+ */
+void pos_simulator_set_time(time32_t time);
+
+/**
+ * @brief Get the current time of the robot in the simulator
+ * @return The current time of the robot (ms)
+ */
+time32_t pos_simulator_get_time();
+
 /* ******************************************* Public callback functions declarations ************************************ */
 
 #endif /* __POS_SIMULATOR_H__ */
\ No newline at end of file